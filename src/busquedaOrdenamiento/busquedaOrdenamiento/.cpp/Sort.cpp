@@ -1,6 +1,12 @@
 #include "../.h/sort.h"
+#include "../.h/sortnet.h"
+#include "../.h/threadpool.h"
+#include "../.h/sortcore.h"
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 
 using namespace std;
 
@@ -11,187 +17,1508 @@ static void imprimir(int arreglo[], int n)
     cout << "\n";
 }
 
+// 0/ Los algoritmos viven en sortcore.h como plantillas; estas versiones int sólo eligen
+// 0/ la política una vez (traza o sólo contadores) y la traza no entra en los bucles sin verbose
+template <typename Algoritmo>
+static void conPolitica(bool verbose, int& comparaciones, int& intercambios, Algoritmo algoritmo)
+{
+    if (verbose)
+    {
+        nucleo::Traza pol;
+        algoritmo(pol);
+        comparaciones += (int)pol.comparaciones;
+        intercambios += (int)pol.intercambios;
+    }
+    else
+    {
+        nucleo::Contadores pol;
+        algoritmo(pol);
+        comparaciones += (int)pol.comparaciones;
+        intercambios += (int)pol.intercambios;
+    }
+}
+
+// 0/ Para los envoltorios que no devuelven contadores: sin verbose no se cuenta nada
+template <typename Algoritmo>
+static void sinContadores(bool verbose, Algoritmo algoritmo)
+{
+    if (verbose)
+    {
+        nucleo::Traza pol;
+        algoritmo(pol);
+    }
+    else
+    {
+        nucleo::Silenciosa pol;
+        algoritmo(pol);
+    }
+}
+
 void ordenarBurbuja(int arreglo[], int n, bool verbose)
 {
-    // 0/ Burbuja: compara vecinos e intercambia si están en orden incorrecto
-    for (int i = 0; i < n - 1; i++)
+    sinContadores(verbose, [&](auto& pol) { nucleo::ordenarBurbuja(arreglo, n, less<int>(), pol); });
+}
+
+void ordenarSeleccion(int arreglo[], int n, bool verbose)
+{
+    sinContadores(verbose, [&](auto& pol) { nucleo::ordenarSeleccion(arreglo, n, less<int>(), pol); });
+}
+
+void ordenarInsercion(int arreglo[], int n, bool verbose)
+{
+    sinContadores(verbose, [&](auto& pol) { nucleo::ordenarInsercion(arreglo, n, less<int>(), pol); });
+}
+
+void quickSort(int arreglo[], int izquierda, int derecha, int& comparaciones, int& intercambios, bool verbose)
+{
+    conPolitica(verbose, comparaciones, intercambios,
+                [&](auto& pol) { nucleo::quickSort(arreglo, izquierda, derecha, less<int>(), pol); });
+}
+
+// 0/ ===================== IntroSort =====================
+
+// 0/ introSort en sí está en sortcore.h; quickSortBloques reutiliza sus auxiliares de nucleo::detalle
+
+void introSort(int arreglo[], int izquierda, int derecha, int& comparaciones, int& intercambios, bool verbose)
+{
+    conPolitica(verbose, comparaciones, intercambios,
+                [&](auto& pol) { nucleo::introSort(arreglo, izquierda, derecha, less<int>(), pol); });
+}
+
+// 0/ ===================== QuickSort por bloques (BlockQuicksort) =====================
+
+// 0/ Elementos revisados por bloque; los desplazamientos caben en un unsigned char
+static const int TAM_BLOQUE = 64;
+
+// 0/ Intercambia num pares (izq + offIzq[k], der - offDer[k]). Si las cantidades
+// 0/ no coinciden se hace como un ciclo (una escritura por elemento en vez de tres)
+static void intercambiarDesplazamientos(int a[], int baseIzq, int baseDer,
+                                        const unsigned char* offIzq, const unsigned char* offDer,
+                                        int num, bool usarIntercambios, nucleo::Contadores& pol)
+{
+    if (usarIntercambios)
+    {
+        for (int k = 0; k < num; k++)
+        {
+            int l = baseIzq + offIzq[k];
+            int r = baseDer - offDer[k];
+            int temp = a[l];
+            a[l] = a[r];
+            a[r] = temp;
+        }
+    }
+    else if (num > 0)
+    {
+        int l = baseIzq + offIzq[0];
+        int r = baseDer - offDer[0];
+        int temp = a[l];
+        a[l] = a[r];
+
+        for (int k = 1; k < num; k++)
+        {
+            l = baseIzq + offIzq[k];
+            a[r] = a[l];
+            r = baseDer - offDer[k];
+            a[l] = a[r];
+        }
+
+        a[r] = temp;
+    }
+
+    pol.intercambio(num);
+}
+
+// 0/ Partición de [inicio, fin) con el pivote en a[inicio]. Los menores quedan a la izquierda y
+// 0/ los mayores o iguales a la derecha. Devuelve la posición final del pivote.
+// 0/ Requiere un elemento >= pivote en el rango (lo garantiza la selección por mediana).
+static int particionBloques(int a[], int inicio, int fin, nucleo::Contadores& pol)
+{
+    int pivote = a[inicio];
+    int primero = inicio;
+    int ultimo = fin;
+
+    while (a[++primero] < pivote) pol.comparacion();
+    pol.comparacion();
+
+    // 0/ Si no quedó nada a la izquierda hay que cuidar no salirse del rango
+    if (primero - 1 == inicio) { while (primero < ultimo && !(a[--ultimo] < pivote)) pol.comparacion(); }
+    else                       { while (!(a[--ultimo] < pivote)) pol.comparacion(); }
+    pol.comparacion();
+
+    if (primero < ultimo)
     {
-        for (int j = 0; j < n - 1 - i; j++)
+        int temp = a[primero];
+        a[primero] = a[ultimo];
+        a[ultimo] = temp;
+        pol.intercambio();
+        primero++;
+
+        unsigned char offIzq[TAM_BLOQUE];
+        unsigned char offDer[TAM_BLOQUE];
+        int baseIzq = primero;
+        int baseDer = ultimo;
+        int numIzq = 0, numDer = 0, iniIzq = 0, iniDer = 0;
+
+        while (primero < ultimo)
         {
-            if (verbose)
-                cout << "[Burbuja] comparo a[" << j << "]=" << arreglo[j]
-                     << " con a[" << (j + 1) << "]=" << arreglo[j + 1] << "\n";
+            // 0/ Sólo se rellena el buffer que quedó vacío en la vuelta anterior
+            int desconocidos = ultimo - primero;
+            int corteIzq = numIzq == 0 ? (numDer == 0 ? desconocidos / 2 : desconocidos) : 0;
+            int corteDer = numDer == 0 ? (desconocidos - corteIzq) : 0;
+            if (corteIzq > TAM_BLOQUE) corteIzq = TAM_BLOQUE;
+            if (corteDer > TAM_BLOQUE) corteDer = TAM_BLOQUE;
 
-            if (arreglo[j] > arreglo[j + 1])
+            // 0/ Sin saltos: el desplazamiento se escribe siempre y el contador avanza con el resultado
+            // 0/ de la comparación, así el procesador no tiene que adivinar nada
+            for (int k = 0; k < corteIzq; k++)
             {
-                int temp = arreglo[j];
-                arreglo[j] = arreglo[j + 1];
-                arreglo[j + 1] = temp;
+                offIzq[numIzq] = (unsigned char)k;
+                numIzq += !(a[primero] < pivote);
+                primero++;
+            }
 
-                if (verbose)
-                {
-                    cout << "  swap -> ";
-                    imprimir(arreglo, n);
-                }
+            for (int k = 0; k < corteDer; )
+            {
+                offDer[numDer] = (unsigned char)++k;
+                numDer += (a[--ultimo] < pivote);
+            }
+
+            pol.comparacion(corteIzq + corteDer);
+
+            int num = numIzq < numDer ? numIzq : numDer;
+            intercambiarDesplazamientos(a, baseIzq, baseDer, offIzq + iniIzq, offDer + iniDer,
+                                        num, numIzq == numDer, pol);
+            numIzq -= num;
+            numDer -= num;
+            iniIzq += num;
+            iniDer += num;
+
+            if (numIzq == 0) { iniIzq = 0; baseIzq = primero; }
+            if (numDer == 0) { iniDer = 0; baseDer = ultimo; }
+        }
+
+        // 0/ Queda a lo sumo un buffer con elementos del lado equivocado
+        if (numIzq)
+        {
+            while (numIzq--)
+            {
+                int l = baseIzq + offIzq[iniIzq + numIzq];
+                --ultimo;
+                temp = a[l]; a[l] = a[ultimo]; a[ultimo] = temp;
+                pol.intercambio();
+            }
+            primero = ultimo;
+        }
+        if (numDer)
+        {
+            while (numDer--)
+            {
+                int r = baseDer - offDer[iniDer + numDer];
+                temp = a[r]; a[r] = a[primero]; a[primero] = temp;
+                pol.intercambio();
+                primero++;
             }
         }
     }
+
+    int posPivote = primero - 1;
+    a[inicio] = a[posPivote];
+    a[posPivote] = pivote;
+    return posPivote;
 }
 
-void ordenarSeleccion(int arreglo[], int n, bool verbose)
+// 0/ Partición para rangos llenos de repetidos: los iguales al pivote van a la izquierda.
+// 0/ Se usa cuando el pivote es igual al del nivel anterior (a[inicio-1])
+static int particionIzquierda(int a[], int inicio, int fin, nucleo::Contadores& pol)
+{
+    int pivote = a[inicio];
+    int primero = inicio;
+    int ultimo = fin;
+
+    while (pivote < a[--ultimo]) pol.comparacion();
+    pol.comparacion();
+
+    if (ultimo + 1 == fin) { while (primero < ultimo && !(pivote < a[++primero])) pol.comparacion(); }
+    else                   { while (!(pivote < a[++primero])) pol.comparacion(); }
+    pol.comparacion();
+
+    while (primero < ultimo)
+    {
+        nucleo::detalle::intercambiar(a, primero, ultimo, pol);
+        while (pivote < a[--ultimo]) pol.comparacion();
+        while (!(pivote < a[++primero])) pol.comparacion();
+        pol.comparacion(2);
+    }
+
+    a[inicio] = a[ultimo];
+    a[ultimo] = pivote;
+    return ultimo;
+}
+
+static void quickSortBloquesInterno(int a[], int inicio, int fin, nucleo::Contadores& pol,
+                                    bool verbose, int profundidadRestante, bool extremoIzquierdo, int depth)
 {
-    // 0/ Selección: encuentra el mínimo del resto y lo pone en su posición
-    for (int i = 0; i < n - 1; i++)
+    less<int> menor;
+
+    while (true)
     {
-        int minIdx = i;
+        int n = fin - inicio;
 
-        for (int j = i + 1; j < n; j++)
+        if (n <= nucleo::detalle::UMBRAL_INSERCION)
         {
-            if (verbose)
-                cout << "[Seleccion] comparo a[" << j << "]=" << arreglo[j]
-                     << " con a[" << minIdx << "]=" << arreglo[minIdx] << "\n";
+            if (n > 1) nucleo::detalle::insercionRango(a, inicio, fin - 1, menor, pol);
+            return;
+        }
 
-            if (arreglo[j] < arreglo[minIdx]) minIdx = j;
+        // 0/ El pivote queda en a[inicio] y hay un elemento >= pivote hacia el final del rango
+        int s2 = n / 2;
+        if (n > 128)
+        {
+            nucleo::detalle::ordenarTres(a, inicio, inicio + s2, fin - 1, menor, pol);
+            nucleo::detalle::ordenarTres(a, inicio + 1, inicio + s2 - 1, fin - 2, menor, pol);
+            nucleo::detalle::ordenarTres(a, inicio + 2, inicio + s2 + 1, fin - 3, menor, pol);
+            nucleo::detalle::ordenarTres(a, inicio + s2 - 1, inicio + s2, inicio + s2 + 1, menor, pol);
+            nucleo::detalle::intercambiar(a, inicio, inicio + s2, pol);
+        }
+        else
+        {
+            nucleo::detalle::ordenarTres(a, inicio + s2, inicio, fin - 1, menor, pol);
         }
 
-        if (minIdx != i)
+        if (verbose)
         {
-            int temp = arreglo[i];
-            arreglo[i] = arreglo[minIdx];
-            arreglo[minIdx] = temp;
+            for (int k = 0; k < depth; k++) cout << "  ";
+            cout << "[QuickBloques] rango " << inicio << "-" << (fin - 1) << " pivote=" << a[inicio] << "\n";
+        }
 
-            if (verbose)
+        // 0/ Si el pivote anterior es igual a éste, todos los iguales ya están en su lugar
+        if (!extremoIzquierdo)
+        {
+            pol.comparacion();
+            if (!(a[inicio - 1] < a[inicio]))
             {
-                cout << "  swap i=" << i << " con minIdx=" << minIdx << " -> ";
-                imprimir(arreglo, n);
+                inicio = particionIzquierda(a, inicio, fin, pol) + 1;
+                continue;
             }
         }
+
+        if (profundidadRestante-- == 0)
+        {
+            nucleo::detalle::heapSortRango(a, inicio, fin - 1, menor, pol);
+            return;
+        }
+
+        int p = particionBloques(a, inicio, fin, pol);
+
+        // 0/ Recursión sobre el lado menor, bucle sobre el mayor
+        if (p - inicio < fin - (p + 1))
+        {
+            quickSortBloquesInterno(a, inicio, p, pol, verbose, profundidadRestante, extremoIzquierdo, depth + 1);
+            inicio = p + 1;
+            extremoIzquierdo = false;
+        }
+        else
+        {
+            quickSortBloquesInterno(a, p + 1, fin, pol, verbose, profundidadRestante, false, depth + 1);
+            fin = p;
+        }
+
+        depth++;
     }
 }
 
-void ordenarInsercion(int arreglo[], int n, bool verbose)
+void quickSortBloques(int arreglo[], int izquierda, int derecha, int& comparaciones, int& intercambios, bool verbose)
+{
+    int n = derecha - izquierda + 1;
+    if (n < 2) return;
+
+    int profundidadMax = 0;
+    for (int m = n; m > 1; m >>= 1) profundidadMax += 2;
+
+    // 0/ Los auxiliares de nucleo::detalle cuentan sobre una política; se suma al final
+    nucleo::Contadores pol;
+    quickSortBloquesInterno(arreglo, izquierda, derecha + 1, pol, verbose, profundidadMax, true, 0);
+    comparaciones += (int)pol.comparaciones;
+    intercambios += (int)pol.intercambios;
+}
+
+// 0/ ===================== Sample sort paralelo =====================
+
+// 0/ Debajo de este tamaño no conviene repartir: se ordena en secuencial
+static const int SAMPLE_MINIMO = 1 << 14;
+// 0/ Muestras por cubeta al elegir separadores (más muestras = cubetas más parejas)
+static const int SAMPLE_SOBREMUESTREO = 32;
+
+// 0/ Cubeta de x = cantidad de separadores <= x. Búsqueda binaria sin saltos: k es potencia de 2
+// 0/ y separadores tiene k - 1 valores ordenados
+static inline int cubetaDe(const int* separadores, int k, int x)
+{
+    int b = 0;
+    for (int paso = k / 2; paso >= 1; paso /= 2)
+        b += (separadores[b + paso - 1] <= x) ? paso : 0;
+    return b;
+}
+
+void sampleSortParalelo(int arreglo[], int n, int hilos)
 {
-    // 0/ Inserción: toma una "clave" y la inserta en la parte ordenada
+    if (hilos <= 0) hilos = hilosPorDefecto();
+
+    if (n < SAMPLE_MINIMO)
+    {
+        int comp = 0, inter = 0;
+        quickSortBloques(arreglo, 0, n - 1, comp, inter);
+        return;
+    }
+
+    PoolHilos& pool = poolCompartido(hilos);
+
+    // 0/ Varias cubetas por hilo para que el reparto dinámico empareje la carga
+    int k = 2;
+    while (k < 4 * hilos && k < 256) k *= 2;
+
+    // 0/ 1) Muestra pseudoaleatoria (semilla fija: corridas reproducibles) y separadores
+    vector<int> muestra(k * SAMPLE_SOBREMUESTREO);
+    unsigned estado = 0x9E3779B9u;
+    for (int i = 0; i < (int)muestra.size(); i++)
+    {
+        estado = estado * 1664525u + 1013904223u;
+        muestra[i] = arreglo[(int)(((unsigned long long)estado * (unsigned)n) >> 32)];
+    }
+    int comp = 0, inter = 0;
+    quickSortBloques(muestra.data(), 0, (int)muestra.size() - 1, comp, inter);
+
+    vector<int> separadores(k - 1);
+    for (int j = 0; j < k - 1; j++)
+        separadores[j] = muestra[(j + 1) * SAMPLE_SOBREMUESTREO];
+
+    // 0/ 2) Cada hilo clasifica su trozo, cuenta por cubeta y guarda la cubeta de cada elemento
+    int trozos = hilos;
+    int tamTrozo = (n + trozos - 1) / trozos;
+    vector<int> conteo((size_t)trozos * k, 0);
+    vector<unsigned char> cubeta(n);
+
+    {
+        GrupoTareas grupo(pool);
+        for (int t = 0; t < trozos; t++)
+        {
+            grupo.lanzar([&, t]() {
+                int ini = t * tamTrozo;
+                int fin = min(n, ini + tamTrozo);
+                int* c = &conteo[(size_t)t * k];
+                for (int i = ini; i < fin; i++)
+                {
+                    int b = cubetaDe(separadores.data(), k, arreglo[i]);
+                    cubeta[i] = (unsigned char)b;
+                    c[b]++;
+                }
+                });
+        }
+        grupo.esperar();
+    }
+
+    // 0/ 3) Suma de prefijos: cubeta por cubeta y, dentro de cada una, trozo por trozo
+    vector<int> inicioCubeta(k + 1, 0);
+    {
+        int suma = 0;
+        for (int b = 0; b < k; b++)
+        {
+            inicioCubeta[b] = suma;
+            for (int t = 0; t < trozos; t++)
+            {
+                int c = conteo[(size_t)t * k + b];
+                conteo[(size_t)t * k + b] = suma;
+                suma += c;
+            }
+        }
+        inicioCubeta[k] = suma;
+    }
+
+    // 0/ 4) Dispersión en un solo recorrido hacia el buffer
+    vector<int> buffer(n);
+    {
+        GrupoTareas grupo(pool);
+        for (int t = 0; t < trozos; t++)
+        {
+            grupo.lanzar([&, t]() {
+                int ini = t * tamTrozo;
+                int fin = min(n, ini + tamTrozo);
+                int* pos = &conteo[(size_t)t * k];
+                for (int i = ini; i < fin; i++)
+                    buffer[pos[cubeta[i]]++] = arreglo[i];
+                });
+        }
+        grupo.esperar();
+    }
+
+    // 0/ 5) Cada cubeta se ordena sola y se copia de vuelta a su lugar final
+    {
+        GrupoTareas grupo(pool);
+        for (int b = 0; b < k; b++)
+        {
+            int ini = inicioCubeta[b];
+            int fin = inicioCubeta[b + 1];
+            if (fin <= ini) continue;
+
+            grupo.lanzar([&, ini, fin]() {
+                int c = 0, s = 0;
+                quickSortBloques(buffer.data(), ini, fin - 1, c, s);
+                for (int i = ini; i < fin; i++) arreglo[i] = buffer[i];
+                });
+        }
+        grupo.esperar();
+    }
+}
+
+void mergeSort(int arreglo[], int izquierda, int derecha, int& comparaciones, bool verbose)
+{
+    int intercambios = 0;
+    conPolitica(verbose, comparaciones, intercambios,
+                [&](auto& pol) { nucleo::mergeSort(arreglo, izquierda, derecha, less<int>(), pol); });
+}
+
+// 0/ ===================== MergeSort con buffer único =====================
+
+// 0/ Mezcla estable de dos rangos ordenados en dst (en empate gana el de la izquierda)
+static void mezclarRangos(const int* a, int n1, const int* b, int n2, int* dst, int& comparaciones)
+{
+    int i = 0, j = 0, k = 0;
+
+    while (i < n1 && j < n2)
+    {
+        comparaciones++;
+        if (a[i] <= b[j]) dst[k++] = a[i++];
+        else              dst[k++] = b[j++];
+    }
+
+    while (i < n1) dst[k++] = a[i++];
+    while (j < n2) dst[k++] = b[j++];
+}
+
+// 0/ MergeSort de abajo hacia arriba: pasadas de ancho 1, 2, 4... alternando
+// 0/ entre arreglo y buffer, así que no hay ninguna reserva de memoria por merge
+void mergeSortIterativo(int arreglo[], int n, int& comparaciones, int* buffer, bool verbose)
+{
+    if (n < 2) return;
+
+    vector<int> propio;
+    if (buffer == nullptr)
+    {
+        propio.resize(n);
+        buffer = propio.data();
+    }
+
+    int* origen = arreglo;
+    int* destino = buffer;
+
+    for (int ancho = 1; ancho < n; ancho *= 2)
+    {
+        for (int lo = 0; lo < n; lo += 2 * ancho)
+        {
+            int medio = min(lo + ancho, n);
+            int hi = min(lo + 2 * ancho, n);
+
+            if (verbose && medio < hi)
+                cout << "[MergeIter] ancho=" << ancho << " combino " << lo << "-" << (medio - 1)
+                     << " con " << medio << "-" << (hi - 1) << "\n";
+
+            mezclarRangos(origen + lo, medio - lo, origen + medio, hi - medio, destino + lo, comparaciones);
+        }
+
+        int* t = origen;
+        origen = destino;
+        destino = t;
+    }
+
+    // 0/ Si el número de pasadas fue impar el resultado quedó en el buffer
+    if (origen != arreglo)
+        for (int k = 0; k < n; k++) arreglo[k] = origen[k];
+}
+
+// 0/ ===================== MergeSort paralelo =====================
+
+struct ContextoMergeParalelo
+{
+    PoolHilos& pool;
+    int grano;
+    atomic<int> comparaciones;
+};
+
+// 0/ Mezcla paralela divide y vencerás: parte el rango mayor a la mitad, busca
+// 0/ el punto de corte en el otro con búsqueda binaria y mezcla ambas mitades como tareas
+static void mezclaParalela(const int* origen, int l1, int r1, int l2, int r2,
+                           int* destino, int pos, ContextoMergeParalelo& ctx)
+{
+    int n1 = r1 - l1;
+    int n2 = r2 - l2;
+
+    if (n1 + n2 <= ctx.grano)
+    {
+        int comp = 0;
+        mezclarRangos(origen + l1, n1, origen + l2, n2, destino + pos, comp);
+        ctx.comparaciones += comp;
+        return;
+    }
+
+    int comp = 0;
+    auto menor = [&comp](int x, int y) { comp++; return x < y; };
+
+    int m1, m2;
+    if (n1 >= n2)
+    {
+        // 0/ Los de la derecha iguales al pivote van después: se conserva la estabilidad
+        m1 = l1 + n1 / 2;
+        m2 = (int)(lower_bound(origen + l2, origen + r2, origen[m1], menor) - origen);
+    }
+    else
+    {
+        m2 = l2 + n2 / 2;
+        m1 = (int)(upper_bound(origen + l1, origen + r1, origen[m2], menor) - origen);
+    }
+    ctx.comparaciones += comp;
+
+    int medio = pos + (m1 - l1) + (m2 - l2);
+
+    GrupoTareas grupo(ctx.pool);
+    grupo.lanzar([&]() { mezclaParalela(origen, l1, m1, l2, m2, destino, pos, ctx); });
+    mezclaParalela(origen, m1, r1, m2, r2, destino, medio, ctx);
+    grupo.esperar();
+}
+
+// 0/ Ordena src[lo, hi); el resultado queda en dst si haciaDestino, si no en src.
+// 0/ Los niveles alternan entre los dos arreglos, así no hay copias por nivel.
+static void mergeSortParaleloInterno(int* src, int* dst, int lo, int hi, bool haciaDestino,
+                                     ContextoMergeParalelo& ctx)
+{
+    int n = hi - lo;
+
+    if (n <= ctx.grano)
+    {
+        int comp = 0;
+        mergeSortIterativo(src + lo, n, comp, dst + lo);
+        if (haciaDestino)
+            for (int k = lo; k < hi; k++) dst[k] = src[k];
+        ctx.comparaciones += comp;
+        return;
+    }
+
+    int medio = lo + n / 2;
+
+    GrupoTareas grupo(ctx.pool);
+    grupo.lanzar([&]() { mergeSortParaleloInterno(src, dst, lo, medio, !haciaDestino, ctx); });
+    mergeSortParaleloInterno(src, dst, medio, hi, !haciaDestino, ctx);
+    grupo.esperar();
+
+    // 0/ Las mitades quedaron en el arreglo contrario al destino de este nivel
+    const int* origen = haciaDestino ? src : dst;
+    int* destino = haciaDestino ? dst : src;
+    mezclaParalela(origen, lo, medio, medio, hi, destino, lo, ctx);
+}
+
+void mergeSortParalelo(int arreglo[], int izquierda, int derecha, int& comparaciones, int hilos, int grano)
+{
+    int n = derecha - izquierda + 1;
+    if (n < 2) return;
+    if (grano < 2) grano = 2;
+
+    ContextoMergeParalelo ctx{ poolCompartido(hilos), grano, { 0 } };
+    vector<int> buffer(n);
+
+    mergeSortParaleloInterno(arreglo + izquierda, buffer.data(), 0, n, false, ctx);
+    comparaciones += ctx.comparaciones;
+}
+
+
+// 0/ ===================== Radix sort LSD =====================
+
+// 0/ Dígitos de 11 bits: 3 pasadas para 32 bits y un histograma de 2048 cubetas (cabe en L1/L2)
+static const int RADIX_BITS = 11;
+static const int RADIX_CUBETAS = 1 << RADIX_BITS;
+static const int RADIX_PASADAS = 3;
+
+// 0/ Invertir el bit de signo hace que el orden sin signo coincida con el orden con signo
+static inline unsigned claveRadix(int x)
+{
+    return (unsigned)x ^ 0x80000000u;
+}
+
+void ordenarRadix(int arreglo[], int n, bool verbose)
+{
+    if (n < 2) return;
+
+    // 0/ Los histogramas de las tres pasadas se llenan en un solo recorrido
+    vector<int> conteo(RADIX_PASADAS * RADIX_CUBETAS, 0);
+    for (int i = 0; i < n; i++)
+    {
+        unsigned u = claveRadix(arreglo[i]);
+        for (int p = 0; p < RADIX_PASADAS; p++)
+            conteo[p * RADIX_CUBETAS + ((u >> (p * RADIX_BITS)) & (RADIX_CUBETAS - 1))]++;
+    }
+
+    vector<int> buffer;
+    int* origen = arreglo;
+    int* destino = nullptr;
+
+    for (int p = 0; p < RADIX_PASADAS; p++)
+    {
+        int desplazamiento = p * RADIX_BITS;
+        int* c = &conteo[p * RADIX_CUBETAS];
+
+        // 0/ Si todos comparten el dígito la pasada no movería nada
+        unsigned digitoPrimero = (claveRadix(origen[0]) >> desplazamiento) & (RADIX_CUBETAS - 1);
+        if (c[digitoPrimero] == n)
+        {
+            if (verbose) cout << "[Radix] pasada " << p << " (bits " << desplazamiento << "+) omitida: digito constante\n";
+            continue;
+        }
+
+        if (destino == nullptr)
+        {
+            buffer.resize(n);
+            destino = buffer.data();
+        }
+
+        // 0/ Suma de prefijos exclusiva: c[d] pasa a ser la primera posición de la cubeta d
+        int suma = 0;
+        for (int d = 0; d < RADIX_CUBETAS; d++)
+        {
+            int t = c[d];
+            c[d] = suma;
+            suma += t;
+        }
+
+        for (int i = 0; i < n; i++)
+        {
+            unsigned d = (claveRadix(origen[i]) >> desplazamiento) & (RADIX_CUBETAS - 1);
+            destino[c[d]++] = origen[i];
+        }
+
+        int* t = origen;
+        origen = destino;
+        destino = t;
+
+        if (verbose)
+        {
+            cout << "[Radix] pasada " << p << " (bits " << desplazamiento << "+) -> ";
+            imprimir(origen, n);
+        }
+    }
+
+    if (origen != arreglo)
+        for (int k = 0; k < n; k++) arreglo[k] = origen[k];
+}
+
+
+// 0/ ===================== Ordenamiento adaptativo =====================
+
+// 0/ Rango máximo (max - min + 1) para usar conteo: el arreglo de conteos no debe pasar de 2n
+// 0/ y nunca de 16M enteros
+static const long long CONTEO_RANGO_MAXIMO = 1LL << 24;
+static const int AUTO_MUESTRA = 1024;
+// 0/ Fracción de vecinos iguales en la muestra ordenada desde la que hay pocos valores distintos
+// 0/ (~100 o menos en 1024): la partición de iguales de quickSortBloques los deja en su lugar en
+// 0/ pocas pasadas y le gana al radix, que hace todas sus pasadas igual
+static const double AUTO_DUPLICADOS_MUCHOS = 0.9;
+// 0/ Desde este n el radix (n enteros extra, 3 pasadas) le gana a quickSortBloques con rango amplio
+static const int AUTO_RADIX_MINIMO = 4096;
+
+// 0/ Conteo sobre [minimo, maximo]: O(n + rango)
+static void ordenarConteo(int arreglo[], int n, int minimo, int maximo)
+{
+    vector<int> conteo((size_t)((long long)maximo - minimo + 1), 0);
+    for (int i = 0; i < n; i++) conteo[arreglo[i] - minimo]++;
+
+    int k = 0;
+    for (size_t v = 0; v < conteo.size(); v++)
+        for (int c = conteo[v]; c > 0; c--) arreglo[k++] = (int)(minimo + (long long)v);
+}
+
+// 0/ Inserción con presupuesto de movimientos: si se pasa devuelve false y deja el arreglo
+// 0/ a medio ordenar (sigue siendo una permutación válida de la entrada)
+static bool insercionAcotada(int arreglo[], int n, long long presupuesto)
+{
+    long long movimientos = 0;
+
     for (int i = 1; i < n; i++)
     {
         int clave = arreglo[i];
         int j = i - 1;
 
-        if (verbose) cout << "[Insercion] clave=" << clave << "\n";
-
         while (j >= 0 && arreglo[j] > clave)
         {
-            if (verbose)
-                cout << "  muevo a[" << j << "]=" << arreglo[j] << " a posicion " << (j + 1) << "\n";
-
             arreglo[j + 1] = arreglo[j];
             j--;
+            movimientos++;
         }
 
         arreglo[j + 1] = clave;
-
-        if (verbose)
-        {
-            cout << "  inserto clave en " << (j + 1) << " -> ";
-            imprimir(arreglo, n);
-        }
+        if (movimientos > presupuesto) return false;
     }
+
+    return true;
 }
 
-// 0/ QuickSort con indent para que se entienda la recursión
-static void quickSortInterno(int arreglo[], int izquierda, int derecha,
-                             int& comparaciones, int& intercambios,
-                             bool verbose, int depth)
+// 0/ Un recorrido para orden previo y rango, más una muestra para estimar duplicados
+static PerfilArreglo perfilarArreglo(const int arreglo[], int n)
 {
-    int i = izquierda;
-    int j = derecha;
-    int pivote = arreglo[(izquierda + derecha) / 2];
+    PerfilArreglo p;
+    p.n = n;
+    if (n == 0) return p;
 
-    if (verbose)
+    int minimo = arreglo[0];
+    int maximo = arreglo[0];
+    int descensos = 0;
+
+    for (int i = 1; i < n; i++)
     {
-        for (int k = 0; k < depth; k++) cout << "  ";
-        cout << "[Quick] rango " << izquierda << "-" << derecha << " pivote=" << pivote << "\n";
+        descensos += arreglo[i - 1] > arreglo[i];
+        minimo = min(minimo, arreglo[i]);
+        maximo = max(maximo, arreglo[i]);
     }
 
-    while (i <= j)
+    p.descensos = descensos;
+    p.corridas = descensos + 1;
+    p.minimo = minimo;
+    p.maximo = maximo;
+
+    int s = min(n, AUTO_MUESTRA);
+    if (s > 1)
     {
-        while (arreglo[i] < pivote) { i++; comparaciones++; }
-        while (arreglo[j] > pivote) { j--; comparaciones++; }
+        vector<int> muestra(s);
+        for (int i = 0; i < s; i++) muestra[i] = arreglo[(int)((long long)i * n / s)];
+        int c = 0, t = 0;
+        quickSortBloques(muestra.data(), 0, s - 1, c, t);
+
+        int iguales = 0;
+        for (int i = 1; i < s; i++) iguales += muestra[i] == muestra[i - 1];
+        p.ratioDuplicados = (double)iguales / (s - 1);
+    }
+
+    return p;
+}
+
+MotorOrdenamiento ordenarAuto(int arreglo[], int n, PerfilArreglo* perfil)
+{
+    PerfilArreglo p = perfilarArreglo(arreglo, n);
+    long long rango = (long long)p.maximo - p.minimo + 1;
 
-        if (i <= j)
+    if (n < 2 || p.descensos == 0)
+    {
+        p.motor = MotorOrdenamiento::Ninguno;
+    }
+    else if (p.descensos == n - 1)
+    {
+        // 0/ Estrictamente decreciente: basta invertirlo
+        p.motor = MotorOrdenamiento::Invertir;
+        for (int i = 0, j = n - 1; i < j; i++, j--)
         {
             int temp = arreglo[i];
             arreglo[i] = arreglo[j];
             arreglo[j] = temp;
-            intercambios++;
+        }
+    }
+    else if (n <= RED_MAXIMO || p.descensos <= n / 64)
+    {
+        // 0/ Casi ordenado: inserción con presupuesto de 8n movimientos; si no alcanza
+        // 0/ (pocas corridas largas pero elementos muy lejos de su lugar) se termina con Timsort
+        p.motor = MotorOrdenamiento::Insercion;
+        if (!insercionAcotada(arreglo, n, 8LL * n + 64))
+        {
+            p.motor = MotorOrdenamiento::Timsort;
+            int c = 0;
+            ordenarTimsort(arreglo, n, c);
+        }
+    }
+    else if (p.corridas <= n / 16)
+    {
+        // 0/ Corridas de largo medio 16 o más: mezclarlas cuesta O(n log corridas)
+        p.motor = MotorOrdenamiento::Timsort;
+        int c = 0;
+        ordenarTimsort(arreglo, n, c);
+    }
+    else if (rango <= 2LL * n && rango <= CONTEO_RANGO_MAXIMO)
+    {
+        p.motor = MotorOrdenamiento::Conteo;
+        ordenarConteo(arreglo, n, p.minimo, p.maximo);
+    }
+    else if (n >= AUTO_RADIX_MINIMO && p.ratioDuplicados < AUTO_DUPLICADOS_MUCHOS)
+    {
+        // 0/ Muchos valores distintos: radix de 3 pasadas de 11 bits; ordenarRadix omite una
+        // 0/ pasada sólo cuando todos los elementos comparten ese dígito
+        p.motor = MotorOrdenamiento::Radix;
+        ordenarRadix(arreglo, n);
+    }
+    else
+    {
+        // 0/ Pocos valores distintos (o n chico): la partición de iguales los resuelve sin radix
+        p.motor = MotorOrdenamiento::QuickSortBloques;
+        int c = 0, t = 0;
+        quickSortBloques(arreglo, 0, n - 1, c, t);
+    }
 
-            if (verbose)
-            {
-                for (int k = 0; k < depth; k++) cout << "  ";
-                cout << "  swap i=" << i << " j=" << j << "\n";
-            }
+    if (perfil != nullptr) *perfil = p;
+    return p.motor;
+}
 
-            i++;
-            j--;
+const char* nombreMotor(MotorOrdenamiento motor)
+{
+    switch (motor)
+    {
+    case MotorOrdenamiento::Ninguno:          return "Ninguno (ya ordenado)";
+    case MotorOrdenamiento::Invertir:         return "Invertir";
+    case MotorOrdenamiento::Insercion:        return "Insercion";
+    case MotorOrdenamiento::Conteo:           return "Conteo";
+    case MotorOrdenamiento::Radix:            return "Radix";
+    case MotorOrdenamiento::QuickSortBloques: return "QuickSortBloques";
+    case MotorOrdenamiento::Timsort:          return "Timsort";
+    }
+    return "Desconocido";
+}
+
+
+// 0/ ===================== Timsort (merge sort natural) =====================
+
+// 0/ Aciertos seguidos de un mismo lado antes de pasar a modo galope
+static const int TIM_GALOPE_MIN = 7;
+// 0/ Suficiente para cualquier n de 32 bits con los invariantes de la pila
+static const int TIM_PILA_MAX = 85;
+
+struct EstadoTimsort
+{
+    int* a;
+    int& comparaciones;
+    bool verbose;
+    int minGalope;
+    vector<int> tmp;
+    int base[TIM_PILA_MAX];
+    int largo[TIM_PILA_MAX];
+    int tamPila;
+};
+
+// 0/ Largo mínimo de corrida: entre 32 y 64, elegido para que n / minRun sea potencia de 2 o apenas menos
+static int timMinRun(int n)
+{
+    int r = 0;
+    while (n >= 64)
+    {
+        r |= n & 1;
+        n >>= 1;
+    }
+    return n + r;
+}
+
+// 0/ Largo de la corrida que empieza en lo; si es estrictamente descendente la invierte
+static int timContarCorrida(int* a, int lo, int hi, int& comparaciones)
+{
+    int fin = lo + 1;
+    if (fin == hi) return 1;
+
+    comparaciones++;
+    if (a[fin++] < a[lo])
+    {
+        while (fin < hi)
+        {
+            comparaciones++;
+            if (!(a[fin] < a[fin - 1])) break;
+            fin++;
+        }
+
+        for (int i = lo, j = fin - 1; i < j; i++, j--)
+        {
+            int temp = a[i];
+            a[i] = a[j];
+            a[j] = temp;
+        }
+    }
+    else
+    {
+        while (fin < hi)
+        {
+            comparaciones++;
+            if (a[fin] < a[fin - 1]) break;
+            fin++;
         }
     }
 
-    if (izquierda < j) quickSortInterno(arreglo, izquierda, j, comparaciones, intercambios, verbose, depth + 1);
-    if (i < derecha)   quickSortInterno(arreglo, i, derecha, comparaciones, intercambios, verbose, depth + 1);
+    return fin - lo;
 }
 
-void quickSort(int arreglo[], int izquierda, int derecha, int& comparaciones, int& intercambios, bool verbose)
+// 0/ Inserción binaria: a[lo, inicio) ya está ordenado, se insertan a[inicio, hi)
+static void timInsercionBinaria(int* a, int lo, int hi, int inicio, int& comparaciones)
 {
-    // 0/ Wrapper para iniciar quicksort con profundidad 0
-    quickSortInterno(arreglo, izquierda, derecha, comparaciones, intercambios, verbose, 0);
+    if (inicio == lo) inicio++;
+
+    for (; inicio < hi; inicio++)
+    {
+        int pivote = a[inicio];
+        int izq = lo;
+        int der = inicio;
+
+        while (izq < der)
+        {
+            int medio = (izq + der) >> 1;
+            comparaciones++;
+            if (pivote < a[medio]) der = medio;
+            else                   izq = medio + 1;
+        }
+
+        memmove(a + izq + 1, a + izq, (size_t)(inicio - izq) * sizeof(int));
+        a[izq] = pivote;
+    }
 }
 
-// 0/ Merge seguro (sin temp[100]) + verbose
-static void merge(int arreglo[], int izquierda, int medio, int derecha, int& comparaciones, bool verbose)
+// 0/ Posición de la primera x en v[base, base+n) con x >= clave, buscando a saltos desde pista
+static int timGalopeIzquierda(int clave, const int* v, int base, int n, int pista, int& comparaciones)
 {
-    int i = izquierda;
-    int j = medio + 1;
+    int ultimo = 0;
+    int ofs = 1;
 
-    vector<int> temp;
-    temp.reserve((derecha - izquierda + 1));
+    comparaciones++;
+    if (clave > v[base + pista])
+    {
+        int maxOfs = n - pista;
+        while (ofs < maxOfs)
+        {
+            comparaciones++;
+            if (!(clave > v[base + pista + ofs])) break;
+            ultimo = ofs;
+            ofs = (ofs << 1) + 1;
+            if (ofs <= 0) ofs = maxOfs;
+        }
+        if (ofs > maxOfs) ofs = maxOfs;
+        ultimo += pista;
+        ofs += pista;
+    }
+    else
+    {
+        int maxOfs = pista + 1;
+        while (ofs < maxOfs)
+        {
+            comparaciones++;
+            if (clave > v[base + pista - ofs]) break;
+            ultimo = ofs;
+            ofs = (ofs << 1) + 1;
+            if (ofs <= 0) ofs = maxOfs;
+        }
+        if (ofs > maxOfs) ofs = maxOfs;
+        int t = ultimo;
+        ultimo = pista - ofs;
+        ofs = pista - t;
+    }
 
-    if (verbose)
-        cout << "[Merge] combino " << izquierda << "-" << medio << " con " << (medio + 1) << "-" << derecha << "\n";
+    // 0/ v[base+ultimo] < clave <= v[base+ofs]: búsqueda binaria en lo que quedó
+    ultimo++;
+    while (ultimo < ofs)
+    {
+        int m = ultimo + ((ofs - ultimo) >> 1);
+        comparaciones++;
+        if (clave > v[base + m]) ultimo = m + 1;
+        else                     ofs = m;
+    }
+    return ofs;
+}
+
+// 0/ Posición después de la última x en v[base, base+n) con x <= clave (los iguales quedan antes)
+static int timGalopeDerecha(int clave, const int* v, int base, int n, int pista, int& comparaciones)
+{
+    int ultimo = 0;
+    int ofs = 1;
+
+    comparaciones++;
+    if (clave < v[base + pista])
+    {
+        int maxOfs = pista + 1;
+        while (ofs < maxOfs)
+        {
+            comparaciones++;
+            if (!(clave < v[base + pista - ofs])) break;
+            ultimo = ofs;
+            ofs = (ofs << 1) + 1;
+            if (ofs <= 0) ofs = maxOfs;
+        }
+        if (ofs > maxOfs) ofs = maxOfs;
+        int t = ultimo;
+        ultimo = pista - ofs;
+        ofs = pista - t;
+    }
+    else
+    {
+        int maxOfs = n - pista;
+        while (ofs < maxOfs)
+        {
+            comparaciones++;
+            if (clave < v[base + pista + ofs]) break;
+            ultimo = ofs;
+            ofs = (ofs << 1) + 1;
+            if (ofs <= 0) ofs = maxOfs;
+        }
+        if (ofs > maxOfs) ofs = maxOfs;
+        ultimo += pista;
+        ofs += pista;
+    }
 
-    while (i <= medio && j <= derecha)
+    ultimo++;
+    while (ultimo < ofs)
     {
+        int m = ultimo + ((ofs - ultimo) >> 1);
         comparaciones++;
-        if (arreglo[i] <= arreglo[j]) temp.push_back(arreglo[i++]);
-        else                          temp.push_back(arreglo[j++]);
+        if (clave < v[base + m]) ofs = m;
+        else                     ultimo = m + 1;
+    }
+    return ofs;
+}
+
+// 0/ Mezcla cuando la corrida izquierda es la menor: se copia a tmp y se mezcla hacia adelante
+static void timMezclaBaja(EstadoTimsort& st, int base1, int largo1, int base2, int largo2)
+{
+    int* a = st.a;
+    int& comp = st.comparaciones;
+    if ((int)st.tmp.size() < largo1) st.tmp.resize(largo1);
+    int* tmp = st.tmp.data();
+
+    memcpy(tmp, a + base1, (size_t)largo1 * sizeof(int));
+    int c1 = 0;
+    int c2 = base2;
+    int dest = base1;
+
+    a[dest++] = a[c2++];
+    if (--largo2 == 0)
+    {
+        memcpy(a + dest, tmp + c1, (size_t)largo1 * sizeof(int));
+        return;
+    }
+    if (largo1 == 1)
+    {
+        memmove(a + dest, a + c2, (size_t)largo2 * sizeof(int));
+        a[dest + largo2] = tmp[c1];
+        return;
+    }
+
+    int minGalope = st.minGalope;
+    bool terminar = false;
+
+    while (!terminar)
+    {
+        int cuenta1 = 0;
+        int cuenta2 = 0;
+
+        // 0/ Modo normal: uno a uno hasta que un lado gane minGalope veces seguidas
+        do
+        {
+            comp++;
+            if (a[c2] < tmp[c1])
+            {
+                a[dest++] = a[c2++];
+                cuenta2++;
+                cuenta1 = 0;
+                if (--largo2 == 0) { terminar = true; break; }
+            }
+            else
+            {
+                a[dest++] = tmp[c1++];
+                cuenta1++;
+                cuenta2 = 0;
+                if (--largo1 == 1) { terminar = true; break; }
+            }
+        } while ((cuenta1 | cuenta2) < minGalope);
+        if (terminar) break;
+
+        // 0/ Modo galope: se copian bloques enteros mientras los saltos sigan rindiendo
+        do
+        {
+            cuenta1 = timGalopeDerecha(a[c2], tmp, c1, largo1, 0, comp);
+            if (cuenta1 != 0)
+            {
+                memcpy(a + dest, tmp + c1, (size_t)cuenta1 * sizeof(int));
+                dest += cuenta1;
+                c1 += cuenta1;
+                largo1 -= cuenta1;
+                if (largo1 <= 1) { terminar = true; break; }
+            }
+            a[dest++] = a[c2++];
+            if (--largo2 == 0) { terminar = true; break; }
+
+            cuenta2 = timGalopeIzquierda(tmp[c1], a, c2, largo2, 0, comp);
+            if (cuenta2 != 0)
+            {
+                memmove(a + dest, a + c2, (size_t)cuenta2 * sizeof(int));
+                dest += cuenta2;
+                c2 += cuenta2;
+                largo2 -= cuenta2;
+                if (largo2 == 0) { terminar = true; break; }
+            }
+            a[dest++] = tmp[c1++];
+            if (--largo1 == 1) { terminar = true; break; }
+
+            minGalope--;
+        } while (cuenta1 >= TIM_GALOPE_MIN || cuenta2 >= TIM_GALOPE_MIN);
+        if (terminar) break;
+
+        if (minGalope < 0) minGalope = 0;
+        minGalope += 2;
     }
 
-    while (i <= medio) temp.push_back(arreglo[i++]);
-    while (j <= derecha) temp.push_back(arreglo[j++]);
+    st.minGalope = minGalope < 1 ? 1 : minGalope;
 
-    for (int k = 0; k < (int)temp.size(); k++)
-        arreglo[izquierda + k] = temp[k];
+    if (largo1 == 1)
+    {
+        memmove(a + dest, a + c2, (size_t)largo2 * sizeof(int));
+        a[dest + largo2] = tmp[c1];
+    }
+    else if (largo1 > 0)
+    {
+        memcpy(a + dest, tmp + c1, (size_t)largo1 * sizeof(int));
+    }
 }
 
-static void mergeSortInterno(int arreglo[], int izquierda, int derecha, int& comparaciones, bool verbose, int depth)
+// 0/ Mezcla cuando la corrida derecha es la menor: se copia a tmp y se mezcla desde el final
+static void timMezclaAlta(EstadoTimsort& st, int base1, int largo1, int base2, int largo2)
 {
-    if (izquierda >= derecha) return;
+    int* a = st.a;
+    int& comp = st.comparaciones;
+    if ((int)st.tmp.size() < largo2) st.tmp.resize(largo2);
+    int* tmp = st.tmp.data();
 
-    int medio = (izquierda + derecha) / 2;
+    memcpy(tmp, a + base2, (size_t)largo2 * sizeof(int));
+    int c1 = base1 + largo1 - 1;
+    int c2 = largo2 - 1;
+    int dest = base2 + largo2 - 1;
 
-    if (verbose)
+    a[dest--] = a[c1--];
+    if (--largo1 == 0)
     {
-        for (int k = 0; k < depth; k++) cout << "  ";
-        cout << "[MergeSort] divido " << izquierda << "-" << derecha << " -> "
-             << izquierda << "-" << medio << " y " << (medio + 1) << "-" << derecha << "\n";
+        memcpy(a + dest - (largo2 - 1), tmp, (size_t)largo2 * sizeof(int));
+        return;
     }
+    if (largo2 == 1)
+    {
+        dest -= largo1;
+        c1 -= largo1;
+        memmove(a + dest + 1, a + c1 + 1, (size_t)largo1 * sizeof(int));
+        a[dest] = tmp[c2];
+        return;
+    }
+
+    int minGalope = st.minGalope;
+    bool terminar = false;
+
+    while (!terminar)
+    {
+        int cuenta1 = 0;
+        int cuenta2 = 0;
+
+        do
+        {
+            comp++;
+            if (tmp[c2] < a[c1])
+            {
+                a[dest--] = a[c1--];
+                cuenta1++;
+                cuenta2 = 0;
+                if (--largo1 == 0) { terminar = true; break; }
+            }
+            else
+            {
+                a[dest--] = tmp[c2--];
+                cuenta2++;
+                cuenta1 = 0;
+                if (--largo2 == 1) { terminar = true; break; }
+            }
+        } while ((cuenta1 | cuenta2) < minGalope);
+        if (terminar) break;
+
+        do
+        {
+            cuenta1 = largo1 - timGalopeDerecha(tmp[c2], a, base1, largo1, largo1 - 1, comp);
+            if (cuenta1 != 0)
+            {
+                dest -= cuenta1;
+                c1 -= cuenta1;
+                largo1 -= cuenta1;
+                memmove(a + dest + 1, a + c1 + 1, (size_t)cuenta1 * sizeof(int));
+                if (largo1 == 0) { terminar = true; break; }
+            }
+            a[dest--] = tmp[c2--];
+            if (--largo2 == 1) { terminar = true; break; }
+
+            cuenta2 = largo2 - timGalopeIzquierda(a[c1], tmp, 0, largo2, largo2 - 1, comp);
+            if (cuenta2 != 0)
+            {
+                dest -= cuenta2;
+                c2 -= cuenta2;
+                largo2 -= cuenta2;
+                memcpy(a + dest + 1, tmp + c2 + 1, (size_t)cuenta2 * sizeof(int));
+                if (largo2 <= 1) { terminar = true; break; }
+            }
+            a[dest--] = a[c1--];
+            if (--largo1 == 0) { terminar = true; break; }
+
+            minGalope--;
+        } while (cuenta1 >= TIM_GALOPE_MIN || cuenta2 >= TIM_GALOPE_MIN);
+        if (terminar) break;
+
+        if (minGalope < 0) minGalope = 0;
+        minGalope += 2;
+    }
+
+    st.minGalope = minGalope < 1 ? 1 : minGalope;
 
-    mergeSortInterno(arreglo, izquierda, medio, comparaciones, verbose, depth + 1);
-    mergeSortInterno(arreglo, medio + 1, derecha, comparaciones, verbose, depth + 1);
-    merge(arreglo, izquierda, medio, derecha, comparaciones, verbose);
+    if (largo2 == 1)
+    {
+        dest -= largo1;
+        c1 -= largo1;
+        memmove(a + dest + 1, a + c1 + 1, (size_t)largo1 * sizeof(int));
+        a[dest] = tmp[c2];
+    }
+    else if (largo2 > 0)
+    {
+        memcpy(a + dest - (largo2 - 1), tmp, (size_t)largo2 * sizeof(int));
+    }
 }
 
-void mergeSort(int arreglo[], int izquierda, int derecha, int& comparaciones, bool verbose)
+// 0/ Mezcla las corridas i e i+1 de la pila
+static void timMezclarEn(EstadoTimsort& st, int i)
+{
+    int base1 = st.base[i];
+    int largo1 = st.largo[i];
+    int base2 = st.base[i + 1];
+    int largo2 = st.largo[i + 1];
+
+    st.largo[i] = largo1 + largo2;
+    if (i == st.tamPila - 3)
+    {
+        st.base[i + 1] = st.base[i + 2];
+        st.largo[i + 1] = st.largo[i + 2];
+    }
+    st.tamPila--;
+
+    if (st.verbose)
+        cout << "[Timsort] mezclo corridas " << base1 << "+" << largo1 << " y " << base2 << "+" << largo2 << "\n";
+
+    // 0/ Lo que de la izquierda ya es <= al primero de la derecha no se mueve,
+    // 0/ ni lo que de la derecha ya es >= al último de la izquierda
+    int k = timGalopeDerecha(st.a[base2], st.a, base1, largo1, 0, st.comparaciones);
+    base1 += k;
+    largo1 -= k;
+    if (largo1 == 0) return;
+
+    largo2 = timGalopeIzquierda(st.a[base1 + largo1 - 1], st.a, base2, largo2, largo2 - 1, st.comparaciones);
+    if (largo2 == 0) return;
+
+    if (largo1 <= largo2) timMezclaBaja(st, base1, largo1, base2, largo2);
+    else                  timMezclaAlta(st, base1, largo1, base2, largo2);
+}
+
+// 0/ Restablece los invariantes de la pila: largo[i-2] > largo[i-1] + largo[i] y largo[i-1] > largo[i]
+static void timColapsar(EstadoTimsort& st)
+{
+    while (st.tamPila > 1)
+    {
+        int n = st.tamPila - 2;
+
+        if ((n > 0 && st.largo[n - 1] <= st.largo[n] + st.largo[n + 1]) ||
+            (n > 1 && st.largo[n - 2] <= st.largo[n] + st.largo[n - 1]))
+        {
+            if (st.largo[n - 1] < st.largo[n + 1]) n--;
+        }
+        else if (st.largo[n] > st.largo[n + 1])
+        {
+            break;
+        }
+
+        timMezclarEn(st, n);
+    }
+}
+
+static void timColapsarTodo(EstadoTimsort& st)
 {
-    // 0/ Wrapper para iniciar mergeSort con profundidad 0
-    mergeSortInterno(arreglo, izquierda, derecha, comparaciones, verbose, 0);
-}
\ No newline at end of file
+    while (st.tamPila > 1)
+    {
+        int n = st.tamPila - 2;
+        if (n > 0 && st.largo[n - 1] < st.largo[n + 1]) n--;
+        timMezclarEn(st, n);
+    }
+}
+
+void ordenarTimsort(int arreglo[], int n, int& comparaciones, bool verbose)
+{
+    if (n < 2) return;
+
+    EstadoTimsort st{ arreglo, comparaciones, verbose, TIM_GALOPE_MIN, {}, {}, {}, 0 };
+
+    int minRun = timMinRun(n);
+    int lo = 0;
+
+    while (lo < n)
+    {
+        int largo = timContarCorrida(arreglo, lo, n, comparaciones);
+
+        if (verbose) cout << "[Timsort] corrida natural en " << lo << " de largo " << largo << "\n";
+
+        // 0/ Corridas cortas se extienden hasta minRun con inserción binaria
+        if (largo < minRun)
+        {
+            int forzado = min(n - lo, minRun);
+            timInsercionBinaria(arreglo, lo, lo + forzado, lo + largo, comparaciones);
+            largo = forzado;
+        }
+
+        st.base[st.tamPila] = lo;
+        st.largo[st.tamPila] = largo;
+        st.tamPila++;
+        timColapsar(st);
+
+        lo += largo;
+    }
+
+    timColapsarTodo(st);
+}
+
+
+// 0/ ============ MergeSort de poca memoria (buffer de raíz de n + rotaciones) ============
+
+// 0/ Tamaño de los bloques iniciales ordenados por inserción
+static const int BAJA_MEMORIA_BLOQUE = 16;
+
+// 0/ Primera posición de a[lo, hi) con a[i] >= valor
+static int cotaInferior(const int* a, int lo, int hi, int valor, int& comparaciones)
+{
+    while (lo < hi)
+    {
+        int medio = lo + ((hi - lo) >> 1);
+        comparaciones++;
+        if (a[medio] < valor) lo = medio + 1;
+        else                  hi = medio;
+    }
+    return lo;
+}
+
+// 0/ Primera posición de a[lo, hi) con a[i] > valor
+static int cotaSuperior(const int* a, int lo, int hi, int valor, int& comparaciones)
+{
+    while (lo < hi)
+    {
+        int medio = lo + ((hi - lo) >> 1);
+        comparaciones++;
+        if (valor < a[medio]) hi = medio;
+        else                  lo = medio + 1;
+    }
+    return lo;
+}
+
+// 0/ Mezcla estable de a[lo, medio) y a[medio, hi) con a lo sumo tamBuf enteros de buffer:
+// 0/ si una de las mitades cabe en el buffer se mezcla directo; si no, se parte la mayor por
+// 0/ la mitad, se busca el corte en la otra, se rota el centro y se sigue con cada lado
+static void mezclarPocaMemoria(int* a, int lo, int medio, int hi, int* buf, int tamBuf, int& comparaciones)
+{
+    while (lo < medio && medio < hi)
+    {
+        // 0/ Ya están en orden
+        comparaciones++;
+        if (!(a[medio] < a[medio - 1])) return;
+
+        int n1 = medio - lo;
+        int n2 = hi - medio;
+
+        if (n1 <= tamBuf)
+        {
+            // 0/ Izquierda al buffer y mezcla hacia adelante; ante empate gana la izquierda
+            memcpy(buf, a + lo, (size_t)n1 * sizeof(int));
+            int i = 0, j = medio, k = lo;
+            while (i < n1 && j < hi)
+            {
+                comparaciones++;
+                if (a[j] < buf[i]) a[k++] = a[j++];
+                else               a[k++] = buf[i++];
+            }
+            while (i < n1) a[k++] = buf[i++];
+            return;
+        }
+
+        if (n2 <= tamBuf)
+        {
+            // 0/ Derecha al buffer y mezcla desde el final; ante empate gana la derecha (va después)
+            memcpy(buf, a + medio, (size_t)n2 * sizeof(int));
+            int i = medio - 1, j = n2 - 1, k = hi - 1;
+            while (i >= lo && j >= 0)
+            {
+                comparaciones++;
+                if (buf[j] < a[i]) a[k--] = a[i--];
+                else               a[k--] = buf[j--];
+            }
+            while (j >= 0) a[k--] = buf[j--];
+            return;
+        }
+
+        int corte1, corte2;
+        if (n1 >= n2)
+        {
+            corte1 = lo + n1 / 2;
+            corte2 = cotaInferior(a, medio, hi, a[corte1], comparaciones);
+        }
+        else
+        {
+            corte2 = medio + n2 / 2;
+            corte1 = cotaSuperior(a, lo, medio, a[corte2], comparaciones);
+        }
+
+        rotate(a + corte1, a + medio, a + corte2);
+        int nuevoMedio = corte1 + (corte2 - medio);
+
+        // 0/ Recursión en el lado más corto y bucle en el otro: profundidad O(log n)
+        if (nuevoMedio - lo < hi - nuevoMedio)
+        {
+            mezclarPocaMemoria(a, lo, corte1, nuevoMedio, buf, tamBuf, comparaciones);
+            lo = nuevoMedio;
+            medio = corte2;
+        }
+        else
+        {
+            mezclarPocaMemoria(a, nuevoMedio, corte2, hi, buf, tamBuf, comparaciones);
+            hi = nuevoMedio;
+            medio = corte1;
+        }
+    }
+}
+
+void mergeSortBajaMemoria(int arreglo[], int n, int& comparaciones, bool verbose)
+{
+    if (n < 2) return;
+
+    // 0/ Bloques iniciales por inserción (estable)
+    for (int lo = 0; lo < n; lo += BAJA_MEMORIA_BLOQUE)
+    {
+        int hi = min(n, lo + BAJA_MEMORIA_BLOQUE);
+        for (int i = lo + 1; i < hi; i++)
+        {
+            int clave = arreglo[i];
+            int j = i - 1;
+            while (j >= lo)
+            {
+                comparaciones++;
+                if (!(clave < arreglo[j])) break;
+                arreglo[j + 1] = arreglo[j];
+                j--;
+            }
+            arreglo[j + 1] = clave;
+        }
+    }
+
+    int tamBuf = 1;
+    while ((long long)tamBuf * tamBuf < n) tamBuf++;
+    vector<int> buffer(tamBuf);
+
+    if (verbose) cout << "[MergeSortBajaMemoria] buffer de " << tamBuf << " enteros para n=" << n << "\n";
+
+    for (int ancho = BAJA_MEMORIA_BLOQUE; ancho < n; ancho *= 2)
+    {
+        for (int lo = 0; lo < n - ancho; lo += 2 * ancho)
+        {
+            int medio = lo + ancho;
+            int hi = (int)min((long long)n, (long long)lo + 2LL * ancho);
+            mezclarPocaMemoria(arreglo, lo, medio, hi, buffer.data(), tamBuf, comparaciones);
+        }
+
+        if (verbose) cout << "[MergeSortBajaMemoria] corridas de " << 2LL * ancho << " mezcladas\n";
+        if (ancho > n / 2) break;
+    }
+}
@@ -0,0 +1,91 @@
+/**
+ * @file batchsearch.cpp
+ * @brief Implementación de la búsqueda por lotes (intercalada y por recorrido)
+ */
+
+#include "../.h/batchsearch.h"
+#include "../.h/recordsort.h"
+#include "../.h/simd.h"
+
+#include <vector>
+
+// 0/ Consultas que bajan juntas: suficientes para tapar la latencia de memoria y todavía
+// 0/ caben en registros / L1 (base y valor de cada una)
+static const int GRUPO_INTERCALADO = 16;
+
+// 0/ Cota inferior de g consultas a la vez. Todas empiezan con el rango completo, así que el
+// 0/ largo del rango es el mismo para todas y el bucle de niveles es común al grupo
+static void cotaInferiorGrupo(const int* a, int n, const int* x, int g, int* posiciones)
+{
+    const int* base[GRUPO_INTERCALADO];
+    for (int j = 0; j < g; j++) base[j] = a;
+
+    int largo = n;
+    while (largo > 1)
+    {
+        int mitad = largo / 2;
+        int siguiente = (largo - mitad) / 2;
+
+        for (int j = 0; j < g; j++)
+        {
+            // 0/ Sin salto: el compilador lo resuelve con cmov
+            base[j] = (base[j][mitad] < x[j]) ? base[j] + mitad : base[j];
+
+            // 0/ Próxima posición que va a leer esta consulta: llega mientras se atiende al resto
+            precargarLectura(base[j] + siguiente);
+        }
+
+        largo -= mitad;
+    }
+
+    for (int j = 0; j < g; j++)
+    {
+        int p = (int)(base[j] - a) + (*base[j] < x[j]);
+        posiciones[j] = (p < n && a[p] == x[j]) ? p : -1;
+    }
+}
+
+static void buscarIntercalado(const int* a, int n, const int* consultas, int q, int* posiciones)
+{
+    for (int i = 0; i < q; i += GRUPO_INTERCALADO)
+    {
+        int g = q - i < GRUPO_INTERCALADO ? q - i : GRUPO_INTERCALADO;
+        cotaInferiorGrupo(a, n, consultas + i, g, posiciones + i);
+    }
+}
+
+static void buscarOrdenandoConsultas(const int* a, int n, const int* consultas, int q, int* posiciones)
+{
+    // 0/ Consultas ordenadas junto con su índice original (radix estable, O(q))
+    std::vector<int> claves(consultas, consultas + q);
+    std::vector<int> indices(q);
+    for (int i = 0; i < q; i++) indices[i] = i;
+    ordenarClavesConIndices(claves.data(), indices.data(), q, ModoOrdenRegistros::Estable);
+
+    // 0/ Mezcla: el cursor del arreglo sólo avanza, así que se lee una vez y en orden
+    int i = 0;
+    for (int k = 0; k < q; k++)
+    {
+        int v = claves[k];
+        while (i < n && a[i] < v) i++;
+        posiciones[indices[k]] = (i < n && a[i] == v) ? i : -1;
+    }
+}
+
+void buscarLote(const int* ordenado, int n, const int* consultas, int q, int* posiciones, ModoLote modo)
+{
+    if (q <= 0) return;
+
+    if (n <= 0)
+    {
+        for (int i = 0; i < q; i++) posiciones[i] = -1;
+        return;
+    }
+
+    if (modo == ModoLote::Automatico)
+        modo = (n >= LOTE_ARREGLO_GRANDE && q >= n / UMBRAL_LOTE_ORDENAR) ? ModoLote::OrdenarYRecorrer
+                                                                            : ModoLote::Intercalado;
+
+    if (modo == ModoLote::OrdenarYRecorrer) buscarOrdenandoConsultas(ordenado, n, consultas, q, posiciones);
+    else                                     buscarIntercalado(ordenado, n, consultas, q, posiciones);
+}
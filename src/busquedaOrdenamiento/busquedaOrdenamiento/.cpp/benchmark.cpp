@@ -6,8 +6,24 @@
 
 #include "../.h/benchmark.h"
 #include "../.h/sort.h"
+#include "../.h/sortcore.h"
 #include "../.h/search.h"
+#include "../.h/searchsimd.h"
+#include "../.h/searchindex.h"
+#include "../.h/batchsearch.h"
+#include "../.h/interpsearch.h"
+#include "../.h/hashindex.h"
+#include "../.h/bloom.h"
+#include "../.h/packedarray.h"
+#include "../.h/sortedlist.h"
+#include "../.h/select.h"
+#include "../.h/externalsort.h"
+#include "../.h/recordsort.h"
+#include "../.h/stringsort.h"
 #include "../.h/generator.h"
+#include "../.h/threadpool.h"
+#include "../.h/sortnet.h"
+#include "../.h/memoria.h"
 
 #include <chrono>
 #include <numeric>
@@ -18,6 +34,11 @@
 #include <iomanip>
 #include <vector>
 #include <functional>
+#include <string>
+#include <filesystem>
+#include <iterator>
+#include <cstdint>
+#include <memory>
 
 using std::cout;
 using std::endl;
@@ -41,6 +62,27 @@ double medirUnaCorridaMs(const std::function<void()>& fn)
     return dt.count();
 }
 
+/**
+ * @brief Calcula promedio, desviación estándar, mínimo y máximo de los tiempos medidos
+ * @param t Tiempos de cada corrida en milisegundos (no vacío)
+ * @return Stats Estadísticas de las corridas
+ *
+ * @complexity O(k) - Tres recorridos sobre los k tiempos
+ */
+static Stats calcularStats(const std::vector<double>& t)
+{
+    double prom = std::accumulate(t.begin(), t.end(), 0.0) / t.size();
+
+    double var = 0.0;
+    for (double x : t) var += (x - prom) * (x - prom);
+    var /= t.size();
+
+    double mn = *std::min_element(t.begin(), t.end());
+    double mx = *std::max_element(t.begin(), t.end());
+
+    return { prom, std::sqrt(var), mn, mx };
+}
+
 /**
  * @brief Mide estadísticas de rendimiento sobre múltiples ejecuciones
  * @param fn Función a benchmarkear
@@ -61,16 +103,1211 @@ Stats medirVariasCorridasMs(const std::function<void()>& fn, int repeticiones, i
     for (int i = 0; i < repeticiones; i++)
         t.push_back(medirUnaCorridaMs(fn));
 
-    double prom = std::accumulate(t.begin(), t.end(), 0.0) / t.size();
+    return calcularStats(t);
+}
 
-    double var = 0.0;
-    for (double x : t) var += (x - prom) * (x - prom);
-    var /= t.size();
+/**
+ * @brief Como medirVariasCorridasMs, pero preparar corre antes de cada corrida fuera del tiempo medido
+ * @param preparar Restaura el estado de partida (p. ej. recargar o copiar la entrada)
+ * @param fn Función a medir
+ * @param repeticiones Corridas medidas
+ * @param warmup Corridas de calentamiento sin medir
+ * @return Stats Estadísticas de fn solamente
+ * @complexity O((repeticiones + warmup) · (T(preparar) + T(fn)))
+ */
+static Stats medirConPreparacionMs(const std::function<void()>& preparar, const std::function<void()>& fn,
+                                   int repeticiones, int warmup = 1)
+{
+    for (int i = 0; i < warmup; i++)
+    {
+        preparar();
+        fn();
+    }
 
-    double mn = *std::min_element(t.begin(), t.end());
-    double mx = *std::max_element(t.begin(), t.end());
+    std::vector<double> t;
+    t.reserve(repeticiones);
 
-    return { prom, std::sqrt(var), mn, mx };
+    for (int i = 0; i < repeticiones; i++)
+    {
+        preparar();
+        t.push_back(medirUnaCorridaMs(fn));
+    }
+
+    return calcularStats(t);
+}
+
+/**
+ * @brief Pico de memoria dinámica extra durante una ejecución de fn
+ * @param fn Función a medir (no debe incluir la copia de la entrada)
+ * @return long long Bytes por encima de lo que ya estaba reservado antes de llamar a fn
+ * @complexity O(T(fn))
+ */
+static long long medirPicoExtraBytes(const std::function<void()>& fn)
+{
+    memoriaReiniciarPico();
+    fn();
+    return (long long)memoriaPicoExtra();
+}
+
+/**
+ * @brief Imprime una fila de resultados y la agrega al CSV
+ * @param csv Archivo de salida ya abierto
+ * @param nombre Nombre del algoritmo
+ * @param n Tamaño de la prueba
+ * @param s Estadísticas medidas
+ * @param picoExtraBytes Memoria extra medida, o -1 si no se midió (columna vacía)
+ * @complexity O(1)
+ */
+static void registrarResultado(std::ofstream& csv, const string& nombre, int n, const Stats& s, long long picoExtraBytes = -1)
+{
+    cout << nombre << " -> " << s.promedio_ms << " ± " << s.desviacion_ms << " ms";
+    if (picoExtraBytes >= 0) cout << ", pico extra " << picoExtraBytes / 1024 << " KB";
+    cout << "\n";
+
+    csv << nombre << "," << n << "," << s.promedio_ms << "," << s.desviacion_ms << "," << s.min_ms << "," << s.max_ms << ",";
+    if (picoExtraBytes >= 0) csv << picoExtraBytes;
+    csv << "\n";
+}
+
+/**
+ * @brief Compara tiempo y pico de memoria extra de las variantes estables de MergeSort
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(n log n) por corrida (O(n log² n) movimientos para la variante de poca memoria)
+ */
+static void benchmarkMemoriaMergeSort(std::ofstream& csv, int repeticiones)
+{
+    const int n = 5'000'000;
+
+    cout << "\n--- MergeSort: tiempo y memoria extra, n = " << n << " ---\n";
+
+    std::vector<int> base = generarArreglo(n);
+
+    auto medir = [&](const string& nombre, const std::function<void(std::vector<int>&)>& sortFn) {
+        Stats s = medirVariasCorridasMs([&]() {
+            std::vector<int> a = base;
+            sortFn(a);
+            }, repeticiones);
+
+        std::vector<int> a = base;
+        long long pico = medirPicoExtraBytes([&]() { sortFn(a); });
+        registrarResultado(csv, nombre, n, s, pico);
+        };
+
+    medir("MergeSort", [](std::vector<int>& a) {
+        int c = 0;
+        mergeSort(a.data(), 0, (int)a.size() - 1, c, false);
+        });
+    medir("MergeSortIterativo", [](std::vector<int>& a) {
+        int c = 0;
+        mergeSortIterativo(a.data(), (int)a.size(), c);
+        });
+    medir("Timsort", [](std::vector<int>& a) {
+        int c = 0;
+        ordenarTimsort(a.data(), (int)a.size(), c);
+        });
+    medir("MergeSortBajaMemoria", [](std::vector<int>& a) {
+        int c = 0;
+        mergeSortBajaMemoria(a.data(), (int)a.size(), c);
+        });
+}
+
+/**
+ * @brief Compara MergeSort secuencial contra MergeSort paralelo y reporta el speedup
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(n log n) por corrida
+ */
+static void benchmarkMergeSortParalelo(std::ofstream& csv, int repeticiones)
+{
+    const int n = 1'000'000;
+    const int hilos = hilosPorDefecto();
+
+    cout << "\n--- MergeSort paralelo, n = " << n << ", hilos = " << hilos << " ---\n";
+
+    std::vector<int> base = generarArreglo(n);
+
+    Stats secuencial = medirVariasCorridasMs([&]() {
+        std::vector<int> a = base;
+        int comp = 0;
+        mergeSort(a.data(), 0, n - 1, comp, false);
+        }, repeticiones);
+    registrarResultado(csv, "MergeSort", n, secuencial);
+
+    Stats paralelo = medirVariasCorridasMs([&]() {
+        std::vector<int> a = base;
+        int comp = 0;
+        mergeSortParalelo(a.data(), 0, n - 1, comp, hilos);
+        }, repeticiones);
+    registrarResultado(csv, "MergeSortParalelo_" + std::to_string(hilos) + "h", n, paralelo);
+
+    cout << "Speedup vs secuencial: " << secuencial.promedio_ms / paralelo.promedio_ms << "x\n";
+}
+
+/**
+ * @brief Mide QuickSort y MergeSort con y sin los kernels de red en sus casos base
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(n log n) por corrida
+ */
+static void benchmarkKernelsRed(std::ofstream& csv, int repeticiones)
+{
+    const int n = 1'000'000;
+
+    cout << "\n--- Kernels de red en casos base, n = " << n << " ---\n";
+
+    std::vector<int> base = generarArreglo(n);
+    bool estadoPrevio = kernelsRedActivos();
+
+    for (int conKernels = 0; conKernels <= 1; conKernels++)
+    {
+        activarKernelsRed(conKernels == 1);
+        string sufijo = conKernels ? "_ConRed" : "_SinRed";
+
+        Stats q = medirVariasCorridasMs([&]() {
+            std::vector<int> a = base;
+            int comp = 0, inter = 0;
+            quickSort(a.data(), 0, n - 1, comp, inter, false);
+            }, repeticiones);
+        registrarResultado(csv, "QuickSort" + sufijo, n, q);
+
+        Stats m = medirVariasCorridasMs([&]() {
+            std::vector<int> a = base;
+            int comp = 0;
+            mergeSort(a.data(), 0, n - 1, comp, false);
+            }, repeticiones);
+        registrarResultado(csv, "MergeSort" + sufijo, n, m);
+    }
+
+    activarKernelsRed(estadoPrevio);
+}
+
+/**
+ * @brief Compara ordenarAuto contra cada motor fijo O(n log n) / O(n) en varias distribuciones
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(n log n) por corrida; los métodos cuadráticos se omiten por el tamaño
+ */
+static void benchmarkOrdenarAuto(std::ofstream& csv, int repeticiones)
+{
+    const int n = 200'000;
+
+    cout << "\n--- ordenarAuto vs motores fijos, n = " << n << " ---\n";
+
+    const Distribucion distribuciones[] = {
+        Distribucion::Uniforme, Distribucion::Ordenado, Distribucion::CasiOrdenado,
+        Distribucion::Invertido, Distribucion::RangoEstrecho, Distribucion::OrganPipe,
+        Distribucion::LotesAgregados
+    };
+
+    for (Distribucion d : distribuciones)
+    {
+        string dist = nombreDistribucion(d);
+        std::vector<int> base = generarArregloDistribucion(n, d);
+
+        auto medir = [&](const string& nombre, const std::function<void(std::vector<int>&)>& sortFn) {
+            Stats s = medirVariasCorridasMs([&]() {
+                std::vector<int> a = base;
+                sortFn(a);
+                }, repeticiones);
+            registrarResultado(csv, nombre + "_" + dist, n, s);
+            };
+
+        cout << "[" << dist << "]\n";
+
+        medir("IntroSort", [](std::vector<int>& a) {
+            int c = 0, t = 0;
+            introSort(a.data(), 0, (int)a.size() - 1, c, t);
+            });
+        medir("QuickSortBloques", [](std::vector<int>& a) {
+            int c = 0, t = 0;
+            quickSortBloques(a.data(), 0, (int)a.size() - 1, c, t);
+            });
+        medir("MergeSortIterativo", [](std::vector<int>& a) {
+            int c = 0;
+            mergeSortIterativo(a.data(), (int)a.size(), c);
+            });
+        medir("Radix", [](std::vector<int>& a) {
+            ordenarRadix(a.data(), (int)a.size());
+            });
+        medir("Timsort", [](std::vector<int>& a) {
+            int c = 0;
+            ordenarTimsort(a.data(), (int)a.size(), c);
+            });
+        medir("Auto", [](std::vector<int>& a) {
+            ordenarAuto(a.data(), (int)a.size());
+            });
+
+        std::vector<int> muestra = base;
+        cout << "  motor elegido: " << nombreMotor(ordenarAuto(muestra.data(), n)) << "\n";
+    }
+}
+
+/**
+ * @brief Timsort contra MergeSort en entradas parcialmente ordenadas: tiempo y comparaciones
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(n log corridas) para Timsort, O(n log n) para MergeSort
+ */
+static void benchmarkTimsort(std::ofstream& csv, int repeticiones)
+{
+    const int n = 200'000;
+
+    cout << "\n--- Timsort vs MergeSort, n = " << n << " ---\n";
+
+    const Distribucion distribuciones[] = {
+        Distribucion::Ordenado, Distribucion::CasiOrdenado, Distribucion::Invertido,
+        Distribucion::OrganPipe, Distribucion::LotesAgregados, Distribucion::Uniforme
+    };
+
+    for (Distribucion d : distribuciones)
+    {
+        string dist = nombreDistribucion(d);
+        std::vector<int> base = generarArregloDistribucion(n, d);
+        int compMerge = 0, compTim = 0;
+
+        cout << "[" << dist << "]\n";
+
+        Stats merge = medirVariasCorridasMs([&]() {
+            std::vector<int> a = base;
+            compMerge = 0;
+            mergeSortIterativo(a.data(), n, compMerge);
+            }, repeticiones);
+        registrarResultado(csv, "MergeSortIterativo_" + dist, n, merge);
+
+        Stats tim = medirVariasCorridasMs([&]() {
+            std::vector<int> a = base;
+            compTim = 0;
+            ordenarTimsort(a.data(), n, compTim);
+            }, repeticiones);
+        registrarResultado(csv, "Timsort_" + dist, n, tim);
+
+        cout << "  comparaciones: MergeSort " << compMerge << ", Timsort " << compTim
+             << " (" << (int)(100.0 * compTim / compMerge + 0.5) << "%)\n";
+    }
+}
+
+/**
+ * @brief Selección contra ordenar todo: mediana, 100 menores y 100 mayores
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(n) para introselect, O(n + k log k) parcial, O(n log k) top-k, O(n log n) ordenar
+ */
+static void benchmarkSeleccion(std::ofstream& csv, int repeticiones)
+{
+    const int n = 1'000'000;
+    const int k = 100;
+
+    cout << "\n--- Seleccion vs ordenamiento completo, n = " << n << ", k = " << k << " ---\n";
+
+    std::vector<int> base = generarArreglo(n, 0, 1 << 30);
+
+    auto medir = [&](const string& nombre, const std::function<int(std::vector<int>&)>& fn) {
+        int comparaciones = 0;
+        Stats s = medirVariasCorridasMs([&]() {
+            std::vector<int> a = base;
+            comparaciones = fn(a);
+            }, repeticiones);
+        registrarResultado(csv, nombre, n, s);
+        cout << "  comparaciones: " << comparaciones << "\n";
+        };
+
+    medir("QuickSort_Completo", [](std::vector<int>& a) {
+        int c = 0, t = 0;
+        quickSort(a.data(), 0, (int)a.size() - 1, c, t, false);
+        return c;
+        });
+    medir("IntroSort_Completo", [](std::vector<int>& a) {
+        int c = 0, t = 0;
+        introSort(a.data(), 0, (int)a.size() - 1, c, t);
+        return c;
+        });
+    medir("SeleccionarK_Mediana", [](std::vector<int>& a) {
+        int c = 0, t = 0;
+        seleccionarK(a.data(), (int)a.size(), (int)a.size() / 2, c, t);
+        return c;
+        });
+    medir("OrdenarParcial_" + std::to_string(k), [k](std::vector<int>& a) {
+        int c = 0, t = 0;
+        ordenarParcial(a.data(), (int)a.size(), k, c, t);
+        return c;
+        });
+
+    // top-k no modifica la entrada: se mide sin copiar
+    int comparaciones = 0;
+    Stats s = medirVariasCorridasMs([&]() {
+        comparaciones = 0;
+        topK(base.data(), n, k, comparaciones);
+        }, repeticiones);
+    registrarResultado(csv, "TopK_" + std::to_string(k), n, s);
+    cout << "  comparaciones: " << comparaciones << "\n";
+}
+
+/**
+ * @brief Ordenamiento externo de un archivo de 16M enteros (64 MB) con distintos presupuestos
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(n log n) por corrida, más O(n) de E/S por pasada de mezcla
+ * @details Los archivos van al directorio temporal del sistema y se borran al terminar
+ */
+static void benchmarkOrdenamientoExterno(std::ofstream& csv, int repeticiones)
+{
+    const long long n = 16'000'000;
+    const string entrada = (std::filesystem::temp_directory_path() / "bench_externo_entrada.bin").string();
+    const string salida = (std::filesystem::temp_directory_path() / "bench_externo_salida.bin").string();
+
+    cout << "\n--- Ordenamiento externo, n = " << n << " (" << n * 4 / (1024 * 1024) << " MB) ---\n";
+
+    if (!generarArchivoBinario(entrada, n, 0, 2'000'000'000))
+    {
+        cout << "No se pudo generar " << entrada << ", se omite.\n";
+        return;
+    }
+
+    for (int megas : { 8, 32, 128 })
+    {
+        ConfigOrdenamientoExterno config;
+        config.memoriaBytes = (std::size_t)megas << 20;
+
+        ResultadoOrdenamientoExterno r;
+        Stats s = medirVariasCorridasMs([&]() {
+            r = ordenarArchivoExterno(entrada, salida, config);
+            }, repeticiones, 0);
+
+        if (!r.exito)
+        {
+            cout << "Error: " << r.error << "\n";
+            break;
+        }
+
+        registrarResultado(csv, "OrdenamientoExterno_" + std::to_string(megas) + "MB", (int)n, s);
+        cout << "  corridas: " << r.corridas << ", pasadas de mezcla: " << r.pasadasMezcla
+             << ", " << (n * 4 / (1024.0 * 1024.0)) / (s.promedio_ms / 1000.0) << " MB/s\n";
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(entrada, ec);
+    std::filesystem::remove(salida, ec);
+}
+
+/**
+ * @brief Registro "gordo" de 64 bytes: clave más carga útil que no participa del orden
+ */
+struct RegistroGrande
+{
+    int clave;
+    int id;
+    char carga[56];
+};
+
+/**
+ * @brief Ordenar registros de 64 bytes en el lugar contra argsort sobre las claves + gather
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(n log n) comparaciones moviendo 64 bytes vs O(n) radix sobre 8 bytes + O(n) gather
+ */
+static void benchmarkArgsort(std::ofstream& csv, int repeticiones)
+{
+    const int n = 500'000;
+
+    cout << "\n--- Registros de " << sizeof(RegistroGrande) << " bytes: en el lugar vs argsort + gather, n = " << n << " ---\n";
+
+    std::vector<int> claves = generarArreglo(n, 0, 1 << 30);
+    std::vector<RegistroGrande> base(n);
+    for (int i = 0; i < n; i++)
+    {
+        base[i].clave = claves[i];
+        base[i].id = i;
+        std::fill(std::begin(base[i].carga), std::end(base[i].carga), (char)i);
+    }
+
+    auto porClave = [](const RegistroGrande& a, const RegistroGrande& b) { return a.clave < b.clave; };
+
+    Stats enSitio = medirVariasCorridasMs([&]() {
+        std::vector<RegistroGrande> r = base;
+        std::sort(r.begin(), r.end(), porClave);
+        }, repeticiones);
+    registrarResultado(csv, "Registros_SortEnSitio", n, enSitio);
+
+    Stats estableEnSitio = medirVariasCorridasMs([&]() {
+        std::vector<RegistroGrande> r = base;
+        std::stable_sort(r.begin(), r.end(), porClave);
+        }, repeticiones);
+    registrarResultado(csv, "Registros_StableSortEnSitio", n, estableEnSitio);
+
+    // Mismo costo de copia que las variantes en el lugar: la copia es el destino del gather
+    for (ModoOrdenRegistros modo : { ModoOrdenRegistros::Estable, ModoOrdenRegistros::Inestable })
+    {
+        string nombre = modo == ModoOrdenRegistros::Estable ? "Estable" : "Inestable";
+
+        Stats s = medirVariasCorridasMs([&]() {
+            std::vector<RegistroGrande> r(n);
+            std::vector<int> k(n);
+            for (int i = 0; i < n; i++) k[i] = base[i].clave;
+            std::vector<int> p = argsort(k.data(), n, modo);
+            aplicarPermutacion(p, base.data(), r.data());
+            }, repeticiones);
+        registrarResultado(csv, "Registros_Argsort" + nombre + "+Gather", n, s);
+
+        Stats soloArgsort = medirVariasCorridasMs([&]() {
+            argsort(claves.data(), n, modo);
+            }, repeticiones);
+        registrarResultado(csv, "Argsort" + nombre + "_SoloClaves", n, soloArgsort);
+    }
+}
+
+/**
+ * @brief Quicksort multiclave contra std::sort y std::stable_sort sobre cadenas
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(D + n log n) multiclave vs O(n log n) comparaciones de cadenas completas
+ */
+static void benchmarkCadenas(std::ofstream& csv, int repeticiones)
+{
+    const int n = 200'000;
+
+    cout << "\n--- Ordenamiento de cadenas, n = " << n << " ---\n";
+
+    for (TipoCadena tipo : { TipoCadena::Aleatoria, TipoCadena::PrefijoComun, TipoCadena::TipoUrl })
+    {
+        string nombreTipo = nombreTipoCadena(tipo);
+        std::vector<string> base = generarCadenas(n, tipo);
+
+        cout << "[" << nombreTipo << "]\n";
+
+        Stats s = medirVariasCorridasMs([&]() {
+            std::vector<string> v = base;
+            std::sort(v.begin(), v.end());
+            }, repeticiones);
+        registrarResultado(csv, "StdSort_" + nombreTipo, n, s);
+
+        s = medirVariasCorridasMs([&]() {
+            std::vector<string> v = base;
+            std::stable_sort(v.begin(), v.end());
+            }, repeticiones);
+        registrarResultado(csv, "StdStableSort_" + nombreTipo, n, s);
+
+        s = medirVariasCorridasMs([&]() {
+            std::vector<string> v = base;
+            ordenarCadenas(v);
+            }, repeticiones);
+        registrarResultado(csv, "QuicksortMulticlave_" + nombreTipo, n, s);
+    }
+}
+
+/**
+ * @brief Curva de escalamiento del sample sort paralelo con 1, 2, 4 y 8 hilos
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(n log n / hilos) por corrida
+ */
+static void benchmarkSampleSort(std::ofstream& csv, int repeticiones)
+{
+    const int n = 2'000'000;
+
+    cout << "\n--- Sample sort paralelo, n = " << n << " ---\n";
+
+    std::vector<int> base = generarArreglo(n);
+    double tiempoUnHilo = 0.0;
+
+    for (int hilos : { 1, 2, 4, 8 })
+    {
+        Stats s = medirVariasCorridasMs([&]() {
+            std::vector<int> a = base;
+            sampleSortParalelo(a.data(), n, hilos);
+            }, repeticiones);
+        registrarResultado(csv, "SampleSort_" + std::to_string(hilos) + "h", n, s);
+
+        if (hilos == 1) tiempoUnHilo = s.promedio_ms;
+        cout << "  speedup vs 1 hilo: " << tiempoUnHilo / s.promedio_ms << "x\n";
+    }
+}
+
+/**
+ * @brief Compara QuickSort contra IntroSort en una entrada "organ-pipe" (1,2,..,k,k,..,2,1)
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(n²) para QuickSort con pivote central en esta entrada, O(n log n) para IntroSort
+ */
+static void benchmarkEntradaAdversa(std::ofstream& csv, int repeticiones)
+{
+    const int n = 10000;
+
+    cout << "\n--- Entrada organ-pipe, n = " << n << " ---\n";
+
+    std::vector<int> base(n);
+    for (int i = 0; i < n; i++) base[i] = (i < n / 2) ? i : n - i;
+
+    Stats quick = medirVariasCorridasMs([&]() {
+        std::vector<int> a = base;
+        int comp = 0, inter = 0;
+        quickSort(a.data(), 0, n - 1, comp, inter, false);
+        }, repeticiones);
+    registrarResultado(csv, "QuickSort_OrganPipe", n, quick);
+
+    Stats intro = medirVariasCorridasMs([&]() {
+        std::vector<int> a = base;
+        int comp = 0, inter = 0;
+        introSort(a.data(), 0, n - 1, comp, inter, false);
+        }, repeticiones);
+    registrarResultado(csv, "IntroSort_OrganPipe", n, intro);
+}
+
+/**
+ * @brief Mide quickSort, introSort, mergeSort y un lote de búsquedas binarias del núcleo para un tipo
+ * @param csv Archivo de resultados
+ * @param base Datos de entrada ya convertidos al tipo
+ * @param tipo Sufijo del tipo para el nombre en el CSV
+ * @param repeticiones Corridas por medición
+ * @complexity O(n log n) por corrida
+ */
+template <typename T>
+static void medirNucleoTipo(std::ofstream& csv, const std::vector<T>& base, const string& tipo, int repeticiones)
+{
+    int n = (int)base.size();
+
+    registrarResultado(csv, "Nucleo_QuickSort_" + tipo, n, medirVariasCorridasMs([&]() {
+        std::vector<T> a = base;
+        nucleo::quickSort(a.data(), n);
+        }, repeticiones));
+
+    registrarResultado(csv, "Nucleo_IntroSort_" + tipo, n, medirVariasCorridasMs([&]() {
+        std::vector<T> a = base;
+        nucleo::introSort(a.data(), n);
+        }, repeticiones));
+
+    registrarResultado(csv, "Nucleo_MergeSort_" + tipo, n, medirVariasCorridasMs([&]() {
+        std::vector<T> a = base;
+        nucleo::mergeSort(a.data(), n);
+        }, repeticiones));
+
+    // Búsquedas sobre la copia ordenada: al menos la mitad de las consultas existe
+    std::vector<T> ordenado = base;
+    std::sort(ordenado.begin(), ordenado.end());
+
+    const int consultas = 1'000'000;
+    long long encontrados = 0;
+    registrarResultado(csv, "Nucleo_Binaria_" + tipo, consultas, medirVariasCorridasMs([&]() {
+        encontrados = 0;
+        for (int q = 0; q < consultas; q++)
+        {
+            T valor = (q & 1) ? ordenado[(q * 7919LL) % n] : base[(q * 104729LL) % n] + (T)1;
+            if (nucleo::busquedaBinaria(ordenado.data(), n, valor) >= 0) encontrados++;
+        }
+        }, repeticiones));
+    cout << "  encontrados: " << encontrados << " de " << consultas << "\n";
+}
+
+/**
+ * @brief Núcleo genérico con distintos tipos de elemento (int32, int64, float, double)
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(n log n) por corrida
+ * @details También compara el envoltorio int (con contadores) contra la plantilla sin
+ *          instrumentación, y un orden descendente con std::greater
+ */
+static void benchmarkTiposNucleo(std::ofstream& csv, int repeticiones)
+{
+    const int n = 1'000'000;
+
+    cout << "\n--- Nucleo generico por tipo, n = " << n << " ---\n";
+
+    std::vector<int> base = generarArreglo(n, 0, 1 << 30);
+
+    std::vector<std::int64_t> base64(n);
+    std::vector<float> baseFloat(n);
+    std::vector<double> baseDouble(n);
+    for (int i = 0; i < n; i++)
+    {
+        // int64 con bits altos ocupados para que no sea un int32 disfrazado
+        base64[i] = ((std::int64_t)base[i] << 31) ^ base[(i + 1) % n];
+        baseFloat[i] = (float)base[i] / 1024.0f;
+        baseDouble[i] = (double)base[i] / 3.0;
+    }
+
+    medirNucleoTipo(csv, base, "int32", repeticiones);
+    medirNucleoTipo(csv, base64, "int64", repeticiones);
+    medirNucleoTipo(csv, baseFloat, "float", repeticiones);
+    medirNucleoTipo(csv, baseDouble, "double", repeticiones);
+
+    // Envoltorio de sort.h: misma plantilla pero con contadores
+    registrarResultado(csv, "QuickSort_EnvoltorioInt", n, medirVariasCorridasMs([&]() {
+        std::vector<int> a = base;
+        int comp = 0, inter = 0;
+        quickSort(a.data(), 0, n - 1, comp, inter, false);
+        }, repeticiones));
+
+    registrarResultado(csv, "Nucleo_IntroSort_double_Descendente", n, medirVariasCorridasMs([&]() {
+        std::vector<double> a = baseDouble;
+        nucleo::introSort(a.data(), n, std::greater<double>());
+        }, repeticiones));
+}
+
+/**
+ * @brief Búsqueda secuencial vectorizada contra la escalar: primera aparición, conteo y todas
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(n) por corrida
+ * @details Se reporta el ancho de banda efectivo (GB/s de arreglo recorrido). La primera
+ *          aparición se mide con un valor ausente para que recorra los 5M elementos.
+ */
+static void benchmarkBusquedaSimd(std::ofstream& csv, int repeticiones)
+{
+    const int n = 5'000'000;
+    const double bytes = (double)n * sizeof(int);
+
+    cout << "\n--- Busqueda secuencial SIMD (" << nivelBusquedaSimd() << ") vs escalar, n = " << n << " ---\n";
+
+    // Valores en [0, 1000): buscar 1000 es un fallo y buscar 7 coincide ~0.1% de las veces
+    std::vector<int> base = generarArreglo(n, 0, 999);
+    std::vector<int> salida(n);
+
+    const int ausente = 1000;
+    const int presente = 7;
+    int resultado = 0;
+
+    auto medir = [&](const string& nombre, bool simd, const std::function<int()>& fn) {
+        activarBusquedaSimd(simd);
+        Stats s = medirVariasCorridasMs([&]() { resultado = fn(); }, repeticiones);
+        registrarResultado(csv, nombre, n, s);
+        cout << "  " << std::fixed << std::setprecision(2) << bytes / (s.promedio_ms * 1e6) << " GB/s"
+             << std::defaultfloat << "  (resultado " << resultado << ")\n";
+        };
+
+    for (bool simd : { false, true })
+    {
+        string sufijo = simd ? "_SIMD" : "_Escalar";
+
+        medir("Secuencial_Primero" + sufijo, simd, [&]() { return buscarPrimeroSimd(base.data(), n, ausente); });
+        medir("Secuencial_Contar" + sufijo, simd, [&]() { return contarIgualesSimd(base.data(), n, presente); });
+        medir("Secuencial_Todos" + sufijo, simd, [&]() { return buscarTodosSimd(base.data(), n, presente, salida.data(), n); });
+    }
+
+    // Vuelve al modo por defecto para el resto de los benchmarks
+    activarBusquedaSimd(true);
+}
+
+/**
+ * @brief Búsqueda secuencial paralela con 1, 2, 4... hasta todos los hilos
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(n) por corrida en el peor caso (fallo)
+ * @details Tres casos: coincidencia temprana (1% del arreglo), tardía (últimos elementos) y
+ *          fallo. Con coincidencia temprana la cancelación corta el recorrido de todos los hilos.
+ */
+static void benchmarkBusquedaParalela(std::ofstream& csv, int repeticiones)
+{
+    const int n = 20'000'000;
+    const int maxHilos = hilosPorDefecto();
+
+    cout << "\n--- Busqueda secuencial paralela, n = " << n << ", hasta " << maxHilos << " hilos ---\n";
+
+    // Valores en [0, 1000); los buscados (-1, -2) sólo aparecen donde se los pone
+    std::vector<int> base = generarArreglo(n, 0, 999);
+    base[n / 100] = -1;
+    base[n - 10] = -2;
+
+    // 1, 2, 4... y por último todos los núcleos aunque no sea potencia de 2
+    std::vector<int> cantidades;
+    for (int h = 1; h < maxHilos; h *= 2) cantidades.push_back(h);
+    cantidades.push_back(maxHilos);
+
+    struct Caso { const char* nombre; int valor; };
+    const Caso casos[] = { { "Temprana", -1 }, { "Tardia", -2 }, { "Fallo", -3 } };
+
+    for (const Caso& caso : casos)
+    {
+        double msUnHilo = 0.0;
+        int esperado = buscarPrimeroSimd(base.data(), n, caso.valor);
+
+        for (int hilos : cantidades)
+        {
+            int resultado = 0;
+            Stats s = medirVariasCorridasMs([&]() {
+                resultado = buscarPrimeroParalelo(base.data(), n, caso.valor, hilos);
+                }, repeticiones);
+            registrarResultado(csv, string("SecuencialParalela_") + caso.nombre + "_" + std::to_string(hilos) + "h", n, s);
+
+            if (hilos == 1) msUnHilo = s.promedio_ms;
+            cout << "  posicion " << resultado << (resultado == esperado ? "" : " (DISTINTA a la secuencial)")
+                 << ", speedup " << msUnHilo / s.promedio_ms << "x\n";
+        }
+    }
+}
+
+/**
+ * @brief Índices de Eytzinger y árbol B contra busquedaBinaria, de 1K a 5M elementos
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(q log n) por corrida, con q = 1M consultas
+ * @details Mitad de las consultas existe y mitad es aleatoria. Se reporta ns por consulta.
+ *          Fuera de la medición se verifica consulta por consulta: los índices devuelven la
+ *          primera aparición (cota inferior) y busquedaBinaria alguna aparición, así que con
+ *          repetidos sólo deben coincidir en encontrado / no encontrado.
+ */
+static void benchmarkIndicesBusqueda(std::ofstream& csv, int repeticiones)
+{
+    const int consultas = 1'000'000;
+
+    cout << "\n--- Indices de busqueda (Eytzinger, arbol B) vs binaria, " << consultas << " consultas ---\n";
+
+    for (int n : { 1'000, 10'000, 100'000, 1'000'000, 5'000'000 })
+    {
+        std::vector<int> ordenado = generarArreglo(n, 0, 1 << 30);
+        std::sort(ordenado.begin(), ordenado.end());
+
+        std::vector<int> q = generarArreglo(consultas, 0, 1 << 30);
+        for (int i = 0; i < consultas; i += 2) q[i] = ordenado[q[i] % n];
+
+        IndiceEytzinger eytzinger(ordenado.data(), n);
+        IndiceArbolB arbolB(ordenado.data(), n);
+
+        auto medir = [&](const string& nombre, const std::function<int(int)>& buscar) {
+            long long suma = 0;
+            Stats s = medirVariasCorridasMs([&]() {
+                suma = 0;
+                for (int i = 0; i < consultas; i++) suma += buscar(q[i]);
+                }, repeticiones);
+            registrarResultado(csv, nombre, n, s);
+            cout << "  " << s.promedio_ms * 1e6 / consultas << " ns/consulta\n";
+            };
+
+        cout << "n = " << n << "\n";
+        medir("Binaria_Consultas", [&](int v) { return busquedaBinaria(ordenado.data(), n, v, false); });
+        medir("Eytzinger_Consultas", [&](int v) { return eytzinger.buscar(v); });
+        medir("ArbolB16_Consultas", [&](int v) { return arbolB.buscar(v); });
+
+        // Verificación sin medir: primera aparición para los índices, alguna para la binaria
+        int errores = 0;
+        for (int i = 0; i < consultas; i++)
+        {
+            int v = q[i];
+            int cota = (int)(std::lower_bound(ordenado.begin(), ordenado.end(), v) - ordenado.begin());
+            int esperado = (cota < n && ordenado[cota] == v) ? cota : -1;
+
+            int b = busquedaBinaria(ordenado.data(), n, v, false);
+            bool binariaBien = esperado < 0 ? b == -1 : (b >= 0 && ordenado[b] == v);
+
+            if (!binariaBien || eytzinger.buscar(v) != esperado || arbolB.buscar(v) != esperado) errores++;
+        }
+        if (errores > 0)
+            cout << "  AVISO: " << errores << " consultas no coinciden con la busqueda binaria\n";
+    }
+}
+
+/**
+ * @brief Búsqueda por lotes contra un bucle de consultas individuales
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(q log n) u O(q + n) por corrida según el modo
+ * @details Se reporta millones de consultas por segundo. El bucle de busquedaSecuencial sólo
+ *          se mide con el lote chico sobre el arreglo chico (O(q·n)).
+ */
+static void benchmarkBusquedaLote(std::ofstream& csv, int repeticiones)
+{
+    cout << "\n--- Busqueda por lotes (millones de consultas por segundo) ---\n";
+
+    for (int n : { 100'000, 5'000'000 })
+    {
+        std::vector<int> ordenado = generarArreglo(n, 0, 1 << 30);
+        std::sort(ordenado.begin(), ordenado.end());
+
+        for (int q : { 1'000, 100'000, 1'000'000 })
+        {
+            std::vector<int> consultas = generarArreglo(q, 0, 1 << 30);
+            for (int i = 0; i < q; i += 2) consultas[i] = ordenado[consultas[i] % n];
+            std::vector<int> posiciones(q);
+
+            cout << "n = " << n << ", q = " << q << "\n";
+
+            auto medir = [&](const string& nombre, const std::function<void()>& fn) {
+                Stats s = medirVariasCorridasMs(fn, repeticiones);
+                registrarResultado(csv, nombre + "_q" + std::to_string(q), n, s);
+                cout << "  " << q / (s.promedio_ms * 1000.0) << " Mconsultas/s\n";
+                };
+
+            if (n <= 100'000 && q <= 1'000)
+            {
+                medir("Lote_BucleSecuencial", [&]() {
+                    for (int i = 0; i < q; i++) posiciones[i] = busquedaSecuencial(ordenado.data(), n, consultas[i], false);
+                    });
+            }
+            medir("Lote_BucleBinaria", [&]() {
+                for (int i = 0; i < q; i++) posiciones[i] = busquedaBinaria(ordenado.data(), n, consultas[i], false);
+                });
+            medir("Lote_Intercalado", [&]() {
+                buscarLote(ordenado.data(), n, consultas.data(), q, posiciones.data(), ModoLote::Intercalado);
+                });
+            medir("Lote_OrdenarYRecorrer", [&]() {
+                buscarLote(ordenado.data(), n, consultas.data(), q, posiciones.data(), ModoLote::OrdenarYRecorrer);
+                });
+            medir("Lote_Automatico", [&]() {
+                buscarLote(ordenado.data(), n, consultas.data(), q, posiciones.data());
+                });
+        }
+    }
+}
+
+/**
+ * @brief Interpolación, exponencial e índice aprendido contra busquedaBinaria
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(q log n) por corrida en el peor caso
+ * @details Distribución uniforme (donde la posición se deduce del valor) y sesgada
+ *          (log-uniforme: la interpolación se equivoca; el modelo sigue acotado por epsilon
+ *          porque los tramos se ajustan a la forma de la distribución).
+ *          Mitad de las consultas existe; la otra mitad es vecina de una clave existente.
+ */
+static void benchmarkBusquedaInterpolacion(std::ofstream& csv, int repeticiones)
+{
+    const int n = 5'000'000;
+    const int consultas = 1'000'000;
+    const int epsilon = 32;
+
+    cout << "\n--- Interpolacion / exponencial / indice aprendido, n = " << n << " ---\n";
+
+    for (Distribucion d : { Distribucion::Uniforme, Distribucion::Sesgada })
+    {
+        // La uniforme de generarArreglo usa todo el rango de 30 bits para que haya pocos repetidos
+        std::vector<int> ordenado = (d == Distribucion::Uniforme) ? generarArreglo(n, 0, 1 << 30)
+                                                                  : generarArregloDistribucion(n, d);
+        std::sort(ordenado.begin(), ordenado.end());
+
+        std::vector<int> q = generarArreglo(consultas, 0, n - 1);
+        for (int i = 0; i < consultas; i++) q[i] = ordenado[q[i]] + (i & 1);
+
+        string sufijo = string("_") + nombreDistribucion(d);
+        cout << nombreDistribucion(d) << "\n";
+
+        std::unique_ptr<IndiceAprendido> modelo;
+        Stats construccion = medirVariasCorridasMs([&]() {
+            modelo.reset(new IndiceAprendido(ordenado.data(), n, epsilon));
+            }, repeticiones);
+        registrarResultado(csv, "IndiceAprendido_Construccion" + sufijo, n, construccion);
+        cout << "  tramos: " << modelo->tramos() << " (" << modelo->bytesModelo() / 1024 << " KB, epsilon "
+             << epsilon << ")\n";
+
+        long long referencia = -1;
+        auto medir = [&](const string& nombre, const std::function<int(int)>& buscar) {
+            long long encontrados = 0;
+            Stats s = medirVariasCorridasMs([&]() {
+                encontrados = 0;
+                for (int i = 0; i < consultas; i++) encontrados += buscar(q[i]) >= 0;
+                }, repeticiones);
+            registrarResultado(csv, nombre + sufijo, n, s);
+            cout << "  " << s.promedio_ms * 1e6 / consultas << " ns/consulta\n";
+
+            if (referencia < 0) referencia = encontrados;
+            else if (encontrados != referencia) cout << "  AVISO: resultados distintos a la busqueda binaria\n";
+            };
+
+        medir("Binaria", [&](int v) { return busquedaBinaria(ordenado.data(), n, v, false); });
+        medir("Interpolacion", [&](int v) { return busquedaInterpolacion(ordenado.data(), n, v); });
+        medir("Exponencial", [&](int v) { return busquedaExponencial(ordenado.data(), n, v); });
+        medir("IndiceAprendido", [&](int v) { return modelo->buscar(v); });
+    }
+}
+
+/**
+ * @brief Índice hash: costo de construcción, latencia por consulta y punto de equilibrio
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(n + q) para el hash, O(q·n) para las consultas secuenciales medidas
+ * @details El punto de equilibrio es la cantidad de consultas a partir de la cual construir el
+ *          índice (o ordenar para la binaria) se paga solo frente a busquedaSecuencial.
+ */
+static void benchmarkIndiceHash(std::ofstream& csv, int repeticiones)
+{
+    const int n = 1'000'000;
+    const int consultas = 1'000'000;
+    const int consultasSecuencial = 200;
+
+    cout << "\n--- Indice hash vs secuencial y binaria, n = " << n << " ---\n";
+
+    std::vector<int> base = generarArreglo(n, 0, 1 << 30);
+
+    // Mitad presentes y mitad (casi seguro) ausentes
+    std::vector<int> q = generarArreglo(consultas, 0, 1 << 30);
+    for (int i = 0; i < consultas; i += 2) q[i] = base[q[i] % n];
+
+    IndiceHash indice;
+    Stats construccion = medirVariasCorridasMs([&]() { indice.reconstruir(base.data(), n); }, repeticiones);
+    registrarResultado(csv, "IndiceHash_Construccion", n, construccion);
+    cout << "  " << indice.claves() << " claves, " << indice.bytes() / (1024 * 1024) << " MB\n";
+
+    std::vector<int> ordenado;
+    Stats orden = medirVariasCorridasMs([&]() {
+        ordenado = base;
+        std::sort(ordenado.begin(), ordenado.end());
+        }, repeticiones);
+    registrarResultado(csv, "Binaria_OrdenarPrevio", n, orden);
+
+    // Latencia por consulta (ns) de cada método
+    auto porConsulta = [&](const string& nombre, int cuantas, const std::function<int(int)>& buscar) {
+        long long suma = 0;
+        Stats s = medirVariasCorridasMs([&]() {
+            suma = 0;
+            for (int i = 0; i < cuantas; i++) suma += buscar(q[i]);
+            }, repeticiones);
+        registrarResultado(csv, nombre, n, s);
+        double ns = s.promedio_ms * 1e6 / cuantas;
+        cout << "  " << ns << " ns/consulta\n";
+        return ns;
+        };
+
+    double nsSecuencial = porConsulta("Secuencial_PorConsulta", consultasSecuencial,
+                                      [&](int v) { return busquedaSecuencial(base.data(), n, v, false); });
+    double nsBinaria = porConsulta("Binaria_PorConsulta", consultas,
+                                   [&](int v) { return busquedaBinaria(ordenado.data(), n, v, false); });
+    double nsHash = porConsulta("IndiceHash_PorConsulta", consultas,
+                                [&](int v) { return indice.buscar(v); });
+
+    // Consultas k tales que construir + k·hash < k·otro
+    double nsConstruccion = construccion.promedio_ms * 1e6;
+    cout << "Punto de equilibrio del hash vs secuencial: " << (long long)(nsConstruccion / (nsSecuencial - nsHash)) + 1 << " consultas\n";
+    if (nsBinaria > nsHash)
+    {
+        double nsOrden = orden.promedio_ms * 1e6;
+        cout << "Hash vs ordenar + binaria: el hash ";
+        if (nsConstruccion <= nsOrden) cout << "gana desde la primera consulta\n";
+        else cout << "gana desde " << (long long)((nsConstruccion - nsOrden) / (nsBinaria - nsHash)) + 1 << " consultas\n";
+    }
+}
+
+/**
+ * @brief Filtro de Bloom delante de las búsquedas con 0%, 50% y 99% de consultas ausentes
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(q log n) por corrida (binaria), O(q·n) en el peor caso (secuencial)
+ * @details También muestra, para varias tasas objetivo, los bits por elemento y la tasa de
+ *          falsos positivos medida con los contadores del filtro.
+ */
+static void benchmarkFiltroBloom(std::ofstream& csv, int repeticiones)
+{
+    const int n = 1'000'000;
+    const int consultas = 1'000'000;
+    const int consultasSecuencial = 200;
+
+    cout << "\n--- Filtro de Bloom por bloques, n = " << n << " ---\n";
+
+    // Valores pares: cualquier impar es un ausente garantizado
+    std::vector<int> base = generarArreglo(n, 0, 1 << 29);
+    for (int& x : base) x *= 2;
+    std::vector<int> ordenado = base;
+    std::sort(ordenado.begin(), ordenado.end());
+
+    std::vector<int> impares = generarArreglo(consultas, 0, 1 << 29);
+    for (int& x : impares) x = 2 * x + 1;
+
+    for (double tasa : { 0.1, 0.01, 0.001 })
+    {
+        FiltroBloom filtro(base.data(), n, tasa);
+        for (int i = 0; i < consultas; i++) filtro.puedeContener(impares[i]);
+        cout << "Tasa objetivo " << tasa * 100 << "%: k = " << filtro.funcionesHash() << ", "
+             << filtro.bitsPorElemento() << " bits/elemento, tasa medida "
+             << 100.0 * filtro.aceptadas() / filtro.consultas() << "%\n";
+    }
+
+    FiltroBloom filtro(base.data(), n, 0.01);
+
+    for (int porcentajeFallos : { 0, 50, 99 })
+    {
+        std::vector<int> q(consultas);
+        std::vector<int> indices = generarArreglo(consultas, 0, n - 1);
+        for (int i = 0; i < consultas; i++)
+            q[i] = (i % 100 < porcentajeFallos) ? impares[i] : base[indices[i]];
+
+        string sufijo = "_Fallos" + std::to_string(porcentajeFallos);
+        cout << "Consultas ausentes: " << porcentajeFallos << "%\n";
+
+        auto medir = [&](const string& nombre, int cuantas, const std::function<int(int)>& buscar) {
+            filtro.reiniciarContadores();
+            Stats s = medirVariasCorridasMs([&]() {
+                for (int i = 0; i < cuantas; i++) buscar(q[i]);
+                }, repeticiones);
+            registrarResultado(csv, nombre + sufijo, n, s);
+            cout << "  " << s.promedio_ms * 1e6 / cuantas << " ns/consulta";
+            if (filtro.consultas() > 0)
+                cout << "  (filtro: " << filtro.descartes() << " descartes de " << filtro.consultas() << ")";
+            cout << "\n";
+            };
+
+        medir("Binaria", consultas, [&](int v) { return busquedaBinaria(ordenado.data(), n, v, false); });
+        medir("BinariaFiltrada", consultas, [&](int v) { return busquedaBinariaFiltrada(filtro, ordenado.data(), n, v); });
+        medir("Secuencial", consultasSecuencial, [&](int v) { return busquedaSecuencial(base.data(), n, v, false); });
+        medir("SecuencialFiltrada", consultasSecuencial, [&](int v) { return busquedaSecuencialFiltrada(filtro, base.data(), n, v); });
+    }
+}
+
+/**
+ * @brief Arreglo ordenado comprimido: razón de compresión, búsqueda y descompresión vs el arreglo crudo
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(n + q log n) por rango de valores
+ * @details Se prueba con el rango por defecto de generarArreglo (muchos repetidos, brechas
+ *          chicas) y con un rango amplio (brechas de cientos de unidades).
+ */
+static void benchmarkArregloComprimido(std::ofstream& csv, int repeticiones)
+{
+    const int n = 5'000'000;
+    const int consultas = 1'000'000;
+
+    cout << "\n--- Arreglo ordenado comprimido (" << ArregloComprimido::nivelDesempaquetado()
+         << "), n = " << n << " ---\n";
+
+    struct Rango { const char* nombre; int minimo; int maximo; };
+    const Rango rangos[] = { { "RangoDefecto", 1, 100000 }, { "RangoAmplio", 0, 1 << 30 } };
+
+    for (const Rango& r : rangos)
+    {
+        std::vector<int> ordenado = generarArreglo(n, r.minimo, r.maximo);
+        std::sort(ordenado.begin(), ordenado.end());
+
+        // Mitad presentes y mitad del rango completo (en su mayoría ausentes en el amplio)
+        std::vector<int> q = generarArreglo(consultas, r.minimo, r.maximo);
+        std::vector<int> indices = generarArreglo(consultas, 0, n - 1);
+        for (int i = 0; i < consultas; i += 2) q[i] = ordenado[indices[i]];
+
+        string sufijo = string("_") + r.nombre;
+
+        std::unique_ptr<ArregloComprimido> comprimido;
+        Stats compresion = medirVariasCorridasMs([&]() {
+            comprimido = std::make_unique<ArregloComprimido>(ordenado.data(), n);
+            }, repeticiones);
+        registrarResultado(csv, "Comprimido_Construccion" + sufijo, n, compresion);
+
+        cout << r.nombre << " [" << r.minimo << ", " << r.maximo << "]: "
+             << (long long)n * sizeof(int) / (1024 * 1024) << " MB -> "
+             << std::fixed << std::setprecision(2) << comprimido->bytes() / (1024.0 * 1024.0) << " MB, razon "
+             << comprimido->razonCompresion() << "x\n" << std::defaultfloat << std::setprecision(6);
+
+        auto porConsulta = [&](const string& nombre, const std::function<int(int)>& buscar) {
+            long long suma = 0;
+            Stats s = medirVariasCorridasMs([&]() {
+                suma = 0;
+                for (int i = 0; i < consultas; i++) suma += buscar(q[i]);
+                }, repeticiones);
+            registrarResultado(csv, nombre + sufijo, n, s);
+            cout << "  " << s.promedio_ms * 1e6 / consultas << " ns/consulta\n";
+            };
+
+        porConsulta("Binaria_Cruda", [&](int v) { return busquedaBinaria(ordenado.data(), n, v, false); });
+        porConsulta("Comprimido_Buscar", [&](int v) { return comprimido->buscar(v); });
+
+        std::vector<int> salida(n);
+        Stats descompresion = medirVariasCorridasMs([&]() { comprimido->descomprimir(salida.data()); }, repeticiones);
+        registrarResultado(csv, "Comprimido_Descomprimir" + sufijo, n, descompresion);
+        cout << "  Descompresion: " << (double)n / (descompresion.promedio_ms * 1e3) << " M valores/s"
+             << (salida == ordenado ? "" : "  (ERROR: no coincide con el original)") << "\n";
+    }
+}
+
+/**
+ * @brief Lista ordenada mutable vs reordenar + busquedaBinaria con mezclas de lecturas y escrituras
+ * @param csv Archivo de resultados
+ * @param repeticiones Corridas por medición
+ * @complexity O(q·(log n + 512)) para la lista, O(q·n log n) para reordenar en el peor caso
+ * @details Escrituras = mitad inserciones y mitad borrados de valores presentes. La alternativa
+ *          actual reordena el arreglo completo antes de cada lectura que sigue a una escritura;
+ *          también se mide un vector ordenado que inserta y borra en su lugar (O(n) por escritura).
+ */
+static void benchmarkListaOrdenada(std::ofstream& csv, int repeticiones)
+{
+    const int n = 1'000'000;
+    const int operacionesLista = 200'000;
+    const int operacionesVector = 20'000;
+    const int operacionesReordenar = 200;
+
+    cout << "\n--- Lista ordenada mutable, n = " << n << " ---\n";
+
+    std::vector<int> base = generarArreglo(n, 0, 1 << 30);
+    std::vector<int> ordenado = base;
+    std::sort(ordenado.begin(), ordenado.end());
+
+    ListaOrdenada lista;
+    Stats carga = medirVariasCorridasMs([&]() { lista.cargar(ordenado.data(), n); }, repeticiones);
+    registrarResultado(csv, "ListaOrdenada_CargaEnBloque", n, carga);
+    cout << "Carga en bloque: " << lista.hojas() << " hojas\n";
+
+    struct Mezcla { const char* nombre; int porcentajeEscrituras; };
+    const Mezcla mezclas[] = { { "Lecturas99", 1 }, { "Lecturas90", 10 }, { "Mitad", 50 } };
+
+    for (const Mezcla& m : mezclas)
+    {
+        // Secuencia fija de operaciones: 0 = buscar, 1 = insertar, 2 = borrar un valor presente
+        std::vector<int> tipos = generarArreglo(operacionesLista, 0, 99);
+        std::vector<int> valores = generarArreglo(operacionesLista, 0, 1 << 30);
+        for (int i = 0; i < operacionesLista; i++)
+        {
+            if (tipos[i] >= m.porcentajeEscrituras) tipos[i] = 0;
+            else tipos[i] = 1 + (tipos[i] & 1);
+
+            // Lecturas y borrados sobre valores presentes al inicio
+            if (tipos[i] != 1 && (i & 1)) valores[i] = base[valores[i] % n];
+        }
+
+        string sufijo = string("_") + m.nombre;
+        cout << "Escrituras " << m.porcentajeEscrituras << "%\n";
+
+        auto reportar = [&](const string& nombre, int operaciones, const Stats& s) {
+            registrarResultado(csv, nombre + sufijo, n, s);
+            cout << "  " << s.promedio_ms * 1e6 / operaciones << " ns/operacion\n";
+            };
+
+        long long suma = 0;
+
+        // Cada corrida parte del mismo estado; la recarga y las copias quedan fuera del tiempo
+        Stats sLista = medirConPreparacionMs([&]() { lista.cargar(ordenado.data(), n); }, [&]() {
+            for (int i = 0; i < operacionesLista; i++)
+            {
+                if (tipos[i] == 0)      suma += lista.buscar(valores[i]);
+                else if (tipos[i] == 1) lista.insertar(valores[i]);
+                else                    suma += lista.borrar(valores[i]);
+            }
+            }, repeticiones);
+        reportar("ListaOrdenada", operacionesLista, sLista);
+
+        std::vector<int> vec;
+        Stats sVector = medirConPreparacionMs([&]() { vec = ordenado; }, [&]() {
+            for (int i = 0; i < operacionesVector; i++)
+            {
+                auto p = std::lower_bound(vec.begin(), vec.end(), valores[i]);
+                if (tipos[i] == 0)      suma += (p != vec.end() && *p == valores[i]) ? p - vec.begin() : -1;
+                else if (tipos[i] == 1) vec.insert(p, valores[i]);
+                else if (p != vec.end() && *p == valores[i]) vec.erase(p);
+            }
+            }, repeticiones);
+        reportar("VectorOrdenado", operacionesVector, sVector);
+
+        // Alternativa actual: las escrituras van al final sin orden y la próxima lectura reordena
+        Stats sReordenar = medirConPreparacionMs([&]() { vec = ordenado; }, [&]() {
+            bool desordenado = false;
+            for (int i = 0; i < operacionesReordenar; i++)
+            {
+                if (tipos[i] == 1)
+                {
+                    vec.push_back(valores[i]);
+                    desordenado = true;
+                    continue;
+                }
+                if (desordenado)
+                {
+                    std::sort(vec.begin(), vec.end());
+                    desordenado = false;
+                }
+                int p = busquedaBinaria(vec.data(), (int)vec.size(), valores[i], false);
+                if (tipos[i] == 0) suma += p;
+                else if (p >= 0)
+                {
+                    // Borrado: se pisa con el último y queda desordenado
+                    vec[p] = vec.back();
+                    vec.pop_back();
+                    desordenado = true;
+                }
+            }
+            }, repeticiones);
+        reportar("Reordenar_Binaria", operacionesReordenar, sReordenar);
+    }
 }
 
 /**
@@ -93,7 +1330,7 @@ void ejecutarBenchmarks()
     int repeticiones = 10;
 
     std::ofstream csv("resultados.csv");
-    csv << "algoritmo,n,promedio_ms,desviacion_ms,min_ms,max_ms\n";
+    csv << "algoritmo,n,promedio_ms,desviacion_ms,min_ms,max_ms,pico_extra_bytes\n";
     csv << std::fixed << std::setprecision(6);
 
     cout << "\n=== BENCHMARKS (tiempos en ms) ===\n";
@@ -111,8 +1348,10 @@ void ejecutarBenchmarks()
                     sortFn(a);
                     }, repeticiones);
 
-                cout << nombre << " -> " << s.promedio_ms << " ± " << s.desviacion_ms << " ms\n";
-                csv << nombre << "," << n << "," << s.promedio_ms << "," << s.desviacion_ms << "," << s.min_ms << "," << s.max_ms << "\n";
+                std::vector<int> a = base;
+                long long pico = medirPicoExtraBytes([&]() { sortFn(a); });
+
+                registrarResultado(csv, nombre, n, s, pico);
             };
 
         /// @complexity O(n²) - Burbuja cuadrático
@@ -136,12 +1375,48 @@ void ejecutarBenchmarks()
             quickSort(a.data(), 0, (int)a.size() - 1, comp, inter, false);
             });
 
+        /// @complexity O(n log n) garantizado - IntroSort (ninther + heapsort de respaldo)
+        medirOrdenamiento("IntroSort", [&](std::vector<int>& a) {
+            int comp = 0, inter = 0;
+            introSort(a.data(), 0, (int)a.size() - 1, comp, inter, false);
+            });
+
+        /// @complexity O(n log n) - QuickSort con partición por bloques sin saltos
+        medirOrdenamiento("QuickSortBloques", [&](std::vector<int>& a) {
+            int comp = 0, inter = 0;
+            quickSortBloques(a.data(), 0, (int)a.size() - 1, comp, inter, false);
+            });
+
+        /// @complexity O(n) - Radix LSD, a lo sumo 3 pasadas de 11 bits
+        medirOrdenamiento("Radix", [&](std::vector<int>& a) {
+            ordenarRadix(a.data(), (int)a.size(), false);
+            });
+
+        /// @complexity O(n log n) comparaciones con O(raíz de n) de memoria extra
+        medirOrdenamiento("MergeSortBajaMemoria", [&](std::vector<int>& a) {
+            int comp = 0;
+            mergeSortBajaMemoria(a.data(), (int)a.size(), comp);
+            });
+
+        /// @complexity O(n log n) peor, O(n) si ya está ordenado - Timsort
+        medirOrdenamiento("Timsort", [&](std::vector<int>& a) {
+            int comp = 0;
+            ordenarTimsort(a.data(), (int)a.size(), comp);
+            });
+
         /// @complexity O(n log n) garantizado - MergeSort
         medirOrdenamiento("MergeSort", [&](std::vector<int>& a) {
             int comp = 0;
             mergeSort(a.data(), 0, (int)a.size() - 1, comp, false);
             });
 
+        /// @complexity O(n log n) - MergeSort iterativo, buffer reutilizado entre corridas
+        std::vector<int> scratch(n);
+        medirOrdenamiento("MergeSortIterativo", [&](std::vector<int>& a) {
+            int comp = 0;
+            mergeSortIterativo(a.data(), (int)a.size(), comp, scratch.data());
+            });
+
         // Búsqueda Secuencial
         {
             int valor = base[n / 2];
@@ -150,7 +1425,7 @@ void ejecutarBenchmarks()
                 }, repeticiones);
 
             cout << "BusquedaSecuencial -> " << s.promedio_ms << " ± " << s.desviacion_ms << " ms\n";
-            csv << "BusquedaSecuencial" << "," << n << "," << s.promedio_ms << "," << s.desviacion_ms << "," << s.min_ms << "," << s.max_ms << "\n";
+            csv << "BusquedaSecuencial" << "," << n << "," << s.promedio_ms << "," << s.desviacion_ms << "," << s.min_ms << "," << s.max_ms << ",\n";
         }
 
         // Búsqueda Binaria
@@ -164,10 +1439,32 @@ void ejecutarBenchmarks()
                 }, repeticiones);
 
             cout << "BusquedaBinaria -> " << s.promedio_ms << " ± " << s.desviacion_ms << " ms\n";
-            csv << "BusquedaBinaria" << "," << n << "," << s.promedio_ms << "," << s.desviacion_ms << "," << s.min_ms << "," << s.max_ms << "\n";
+            csv << "BusquedaBinaria" << "," << n << "," << s.promedio_ms << "," << s.desviacion_ms << "," << s.min_ms << "," << s.max_ms << ",\n";
         }
     }
 
+    benchmarkMergeSortParalelo(csv, 5);
+    benchmarkSampleSort(csv, 5);
+    benchmarkKernelsRed(csv, 5);
+    benchmarkTimsort(csv, 5);
+    benchmarkMemoriaMergeSort(csv, 3);
+    benchmarkOrdenarAuto(csv, 5);
+    benchmarkSeleccion(csv, 5);
+    benchmarkArgsort(csv, 5);
+    benchmarkCadenas(csv, 5);
+    benchmarkOrdenamientoExterno(csv, 2);
+    benchmarkEntradaAdversa(csv, 5);
+    benchmarkTiposNucleo(csv, 5);
+    benchmarkBusquedaSimd(csv, 5);
+    benchmarkBusquedaParalela(csv, 5);
+    benchmarkIndicesBusqueda(csv, 3);
+    benchmarkBusquedaLote(csv, 3);
+    benchmarkBusquedaInterpolacion(csv, 3);
+    benchmarkIndiceHash(csv, 3);
+    benchmarkFiltroBloom(csv, 3);
+    benchmarkArregloComprimido(csv, 3);
+    benchmarkListaOrdenada(csv, 3);
+
     csv.close();
     cout << "\nListo. Se genero: resultados.csv\n";
 }
\ No newline at end of file
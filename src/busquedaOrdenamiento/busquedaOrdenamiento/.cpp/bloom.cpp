@@ -0,0 +1,137 @@
+/**
+ * @file bloom.cpp
+ * @brief Implementación del filtro de Bloom por bloques
+ */
+
+#include "../.h/bloom.h"
+#include "../.h/search.h"
+#include "../.h/sortcore.h"
+
+#include <cmath>
+
+// 0/ Mezclador de splitmix64: valores consecutivos quedan repartidos en todos los bits
+static inline std::uint64_t mezclar(int valor)
+{
+    std::uint64_t z = (std::uint64_t)(std::uint32_t)valor + 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// 0/ Posición del próximo bit dentro del bloque (0..511). Se avanza g con un paso multiplicativo
+// 0/ y se usan sus 9 bits altos, que son los mejor mezclados: con doble hash sobre 9 bits los
+// 0/ k bits de un valor quedaban correlacionados y la tasa real duplicaba la del modelo
+static inline std::uint32_t siguienteBit(std::uint32_t& g)
+{
+    g = g * 0x9E3779B9u + 0x7F4A7C15u;
+    return g >> 23;
+}
+
+// 0/ Tasa de falsos positivos de un filtro por bloques de 512 bits: la cantidad de valores que
+// 0/ caen en un bloque sigue una Poisson de media 512 / bitsPorElemento, y un bloque con i
+// 0/ valores da falso positivo con probabilidad (1 - (1 - 1/512)^(k·i))^k
+static double tasaPorBloques(double bitsPorElemento, int k)
+{
+    double media = 512.0 / bitsPorElemento;
+    double poisson = std::exp(-media);
+    double tasa = 0.0;
+
+    int limite = (int)(media * 4) + 64;
+    for (int i = 0; i <= limite; i++)
+    {
+        if (i > 0) poisson *= media / i;
+        tasa += poisson * std::pow(1.0 - std::pow(1.0 - 1.0 / 512.0, (double)k * i), (double)k);
+    }
+    return tasa;
+}
+
+// 0/ Menor cantidad de bits por elemento (en pasos de 1/4) con algún k que logre la tasa pedida.
+// 0/ Con tasas bajas el margen sobre el óptimo clásico log2(1/p) / ln 2 crece: los bloques
+// 0/ cargados de más dominan
+static void dimensionar(double tasa, double& bitsPorElemento, int& k)
+{
+    for (bitsPorElemento = 1.0; bitsPorElemento < 64.0; bitsPorElemento += 0.25)
+    {
+        for (k = 1; k <= 16; k++)
+        {
+            if (tasaPorBloques(bitsPorElemento, k) <= tasa) return;
+        }
+    }
+    k = 16;
+}
+
+FiltroBloom::FiltroBloom(const int* a, int n, double tasaFalsosPositivos)
+    : numBloques_(1), k_(1), bitsPorElementoObjetivo_(1.0), n_(0), tasa_(tasaFalsosPositivos),
+      consultas_(0), descartes_(0)
+{
+    if (tasa_ <= 0.0 || tasa_ >= 1.0) tasa_ = 0.01;
+
+    dimensionar(tasa_, bitsPorElementoObjetivo_, k_);
+    reconstruir(a, n);
+}
+
+void FiltroBloom::reconstruir(const int* a, int n)
+{
+    n_ = n < 0 ? 0 : n;
+
+    double bits = bitsPorElementoObjetivo_ * (n_ > 0 ? n_ : 1);
+    numBloques_ = (std::uint64_t)std::ceil(bits / (64.0 * PALABRAS_POR_BLOQUE));
+    if (numBloques_ < 1) numBloques_ = 1;
+
+    bloques_.assign((size_t)numBloques_ * PALABRAS_POR_BLOQUE, 0);
+
+    for (int i = 0; i < n_; i++)
+    {
+        std::uint64_t h = mezclar(a[i]);
+
+        // 0/ Bloque con los 32 bits altos (multiplicar y desplazar en vez de módulo)
+        std::uint64_t* bloque = &bloques_[(size_t)(((h >> 32) * numBloques_) >> 32) * PALABRAS_POR_BLOQUE];
+        std::uint32_t g = (std::uint32_t)h;
+
+        for (int j = 0; j < k_; j++)
+        {
+            std::uint32_t bit = siguienteBit(g);
+            bloque[bit >> 6] |= 1ull << (bit & 63);
+        }
+    }
+
+    reiniciarContadores();
+}
+
+bool FiltroBloom::puedeContener(int valor) const
+{
+    consultas_++;
+
+    std::uint64_t h = mezclar(valor);
+    const std::uint64_t* bloque = &bloques_[(size_t)(((h >> 32) * numBloques_) >> 32) * PALABRAS_POR_BLOQUE];
+    std::uint32_t g = (std::uint32_t)h;
+
+    for (int j = 0; j < k_; j++)
+    {
+        std::uint32_t bit = siguienteBit(g);
+        if (!(bloque[bit >> 6] & (1ull << (bit & 63))))
+        {
+            descartes_++;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+double FiltroBloom::bitsPorElemento() const
+{
+    return n_ > 0 ? (double)bytes() * 8.0 / n_ : 0.0;
+}
+
+int busquedaSecuencialFiltrada(const FiltroBloom& filtro, const int* arr, int n, int valor)
+{
+    if (!filtro.puedeContener(valor)) return -1;
+    return busquedaSecuencial(arr, n, valor, false);
+}
+
+int busquedaBinariaFiltrada(const FiltroBloom& filtro, const int* ordenado, int n, int valor)
+{
+    if (!filtro.puedeContener(valor)) return -1;
+    return nucleo::busquedaBinaria(ordenado, n, valor);
+}
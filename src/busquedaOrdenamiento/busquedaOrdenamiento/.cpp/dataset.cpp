@@ -0,0 +1,58 @@
+/**
+ * @file dataset.cpp
+ * @brief Implementación del conjunto de datos con copia ordenada en caché
+ */
+
+#include "../.h/dataset.h"
+#include "../.h/sort.h"
+
+#include <algorithm>
+#include <utility>
+
+ConjuntoDatos::ConjuntoDatos()
+    : copiaValida_(false), ordenConocido_(true), ordenado_(true)
+{
+}
+
+void ConjuntoDatos::invalidar()
+{
+    // 0/ Se libera la memoria de la copia: con datos grandes no conviene tenerla de más
+    std::vector<int>().swap(copiaOrdenada_);
+    copiaValida_ = false;
+    ordenConocido_ = false;
+}
+
+void ConjuntoDatos::reemplazar(std::vector<int> valores)
+{
+    datos_ = std::move(valores);
+    invalidar();
+}
+
+std::vector<int>& ConjuntoDatos::modificar()
+{
+    invalidar();
+    return datos_;
+}
+
+bool ConjuntoDatos::estaOrdenado() const
+{
+    if (!ordenConocido_)
+    {
+        ordenado_ = std::is_sorted(datos_.begin(), datos_.end());
+        ordenConocido_ = true;
+    }
+    return ordenado_;
+}
+
+const std::vector<int>& ConjuntoDatos::ordenado()
+{
+    if (estaOrdenado()) return datos_;
+
+    if (!copiaValida_)
+    {
+        copiaOrdenada_ = datos_;
+        ordenarAuto(copiaOrdenada_.data(), (int)copiaOrdenada_.size());
+        copiaValida_ = true;
+    }
+    return copiaOrdenada_;
+}
@@ -0,0 +1,350 @@
+/**
+ * @file externalsort.cpp
+ * @brief Implementación del ordenamiento externo con corridas y mezcla por árbol de perdedores
+ */
+
+#include "../.h/externalsort.h"
+#include "../.h/sort.h"
+#include "../.h/generator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <system_error>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+using std::cout;
+using std::string;
+using std::vector;
+
+// 0/ Buffer mínimo por corrida en la mezcla: por debajo de esto la E/S deja de ser secuencial
+static const std::size_t BUFFER_MINIMO_BYTES = 256u << 10;
+// 0/ Tope de corridas abiertas a la vez (límite práctico de archivos abiertos)
+static const int FANIN_MAXIMO = 256;
+// 0/ Buffer de los recorridos de una sola pasada (generar y verificar)
+static const std::size_t BUFFER_RECORRIDO = 1u << 18;
+
+// 0/ Lector secuencial de enteros con buffer propio
+class LectorEnteros
+{
+public:
+    LectorEnteros(const string& ruta, std::size_t capacidad)
+        : archivo_(ruta, std::ios::binary), buffer_(capacidad), pos_(0), tam_(0) {}
+
+    bool abierto() const { return (bool)archivo_; }
+
+    // 0/ Llena buf con hasta max enteros; devuelve cuántos leyó
+    std::size_t leerBloque(int* buf, std::size_t max)
+    {
+        archivo_.read(reinterpret_cast<char*>(buf), (std::streamsize)(max * sizeof(int)));
+        return (std::size_t)archivo_.gcount() / sizeof(int);
+    }
+
+    bool siguiente(int& valor)
+    {
+        if (pos_ == tam_)
+        {
+            tam_ = leerBloque(buffer_.data(), buffer_.size());
+            pos_ = 0;
+            if (tam_ == 0) return false;
+        }
+        valor = buffer_[pos_++];
+        return true;
+    }
+
+private:
+    std::ifstream archivo_;
+    vector<int> buffer_;
+    std::size_t pos_;
+    std::size_t tam_;
+};
+
+// 0/ Escritor secuencial de enteros con buffer propio
+class EscritorEnteros
+{
+public:
+    EscritorEnteros(const string& ruta, std::size_t capacidad)
+        : archivo_(ruta, std::ios::binary | std::ios::trunc), buffer_(capacidad), tam_(0) {}
+
+    bool abierto() const { return (bool)archivo_; }
+
+    void escribirBloque(const int* buf, std::size_t n)
+    {
+        archivo_.write(reinterpret_cast<const char*>(buf), (std::streamsize)(n * sizeof(int)));
+    }
+
+    void agregar(int valor)
+    {
+        buffer_[tam_++] = valor;
+        if (tam_ == buffer_.size()) vaciar();
+    }
+
+    void vaciar()
+    {
+        if (tam_ > 0) escribirBloque(buffer_.data(), tam_);
+        tam_ = 0;
+    }
+
+    // 0/ Vacía lo pendiente y cierra; false si alguna escritura falló
+    bool cerrar()
+    {
+        vaciar();
+        archivo_.close();
+        return !archivo_.fail();
+    }
+
+private:
+    std::ofstream archivo_;
+    vector<int> buffer_;
+    std::size_t tam_;
+};
+
+// 0/ Árbol de perdedores sobre k fuentes: cada nodo interno guarda la fuente que perdió
+// 0/ ahí y arbol_[0] la ganadora; reponer la ganadora cuesta log2(k) comparaciones
+class ArbolPerdedores
+{
+public:
+    explicit ArbolPerdedores(vector<LectorEnteros*>& fuentes)
+        : fuentes_(fuentes), k_((int)fuentes.size()), arbol_(k_, -1), clave_(k_), agotada_(k_, false)
+    {
+        for (int i = 0; i < k_; i++) agotada_[i] = !fuentes_[i]->siguiente(clave_[i]);
+        for (int i = k_ - 1; i >= 0; i--) ajustar(i);
+    }
+
+    // 0/ Saca el menor de todas las fuentes; false cuando se agotaron todas
+    bool extraer(int& valor)
+    {
+        int g = arbol_[0];
+        if (agotada_[g]) return false;
+
+        valor = clave_[g];
+        agotada_[g] = !fuentes_[g]->siguiente(clave_[g]);
+        ajustar(g);
+        return true;
+    }
+
+private:
+    bool gana(int a, int b) const
+    {
+        if (agotada_[a]) return false;
+        if (agotada_[b]) return true;
+        return clave_[a] < clave_[b];
+    }
+
+    // 0/ Sube la fuente s desde su hoja; en cada nodo se queda la perdedora
+    void ajustar(int s)
+    {
+        for (int t = (s + k_) >> 1; t > 0; t >>= 1)
+        {
+            // 0/ Sólo durante la construcción: primer llegado espera a su rival
+            if (arbol_[t] == -1)
+            {
+                arbol_[t] = s;
+                return;
+            }
+            if (gana(arbol_[t], s)) std::swap(s, arbol_[t]);
+        }
+        arbol_[0] = s;
+    }
+
+    vector<LectorEnteros*>& fuentes_;
+    int k_;
+    vector<int> arbol_;
+    vector<int> clave_;
+    vector<bool> agotada_;
+};
+
+// 0/ Mezcla las corridas en un archivo de salida usando a lo sumo memoriaBytes de buffers
+static bool mezclarCorridas(const vector<string>& corridas, const string& salida, std::size_t memoriaBytes)
+{
+    std::size_t porBuffer = std::max(BUFFER_MINIMO_BYTES, memoriaBytes / (corridas.size() + 1)) / sizeof(int);
+
+    vector<std::unique_ptr<LectorEnteros>> lectores;
+    vector<LectorEnteros*> fuentes;
+    for (const string& ruta : corridas)
+    {
+        lectores.emplace_back(new LectorEnteros(ruta, porBuffer));
+        if (!lectores.back()->abierto()) return false;
+        fuentes.push_back(lectores.back().get());
+    }
+
+    EscritorEnteros escritor(salida, porBuffer);
+    if (!escritor.abierto()) return false;
+
+    ArbolPerdedores arbol(fuentes);
+    int valor;
+    while (arbol.extraer(valor)) escritor.agregar(valor);
+
+    return escritor.cerrar();
+}
+
+ResultadoOrdenamientoExterno ordenarArchivoExterno(const string& entrada, const string& salida,
+                                                   const ConfigOrdenamientoExterno& config)
+{
+    ResultadoOrdenamientoExterno r;
+    auto t0 = std::chrono::steady_clock::now();
+    std::error_code ec;
+
+    std::uintmax_t bytes = fs::file_size(entrada, ec);
+    if (ec)
+    {
+        r.error = "No se pudo leer " + entrada + ": " + ec.message();
+        return r;
+    }
+    // 0/ Bytes sobrantes al final: no es un archivo de int32 y la salida los perdería
+    if (bytes % sizeof(int) != 0)
+    {
+        r.error = entrada + " no es un archivo de int32: " + std::to_string(bytes) +
+                  " bytes no es multiplo de " + std::to_string(sizeof(int));
+        return r;
+    }
+    r.elementos = (long long)(bytes / sizeof(int));
+
+    // 0/ Directorio propio para las corridas, dentro del temporal elegido
+    fs::path base = config.directorioTemporal.empty() ? fs::temp_directory_path(ec) : fs::path(config.directorioTemporal);
+    fs::path dir;
+    for (unsigned intento = 0; ; intento++)
+    {
+        dir = base / ("ordext_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count() + intento));
+        if (fs::create_directories(dir, ec)) break;
+        if (ec || intento > 100)
+        {
+            r.error = "No se pudo crear el directorio temporal en " + base.string();
+            return r;
+        }
+    }
+
+    // 0/ El trozo usa un tercio del presupuesto: el resto queda para el buffer auxiliar que
+    // 0/ pueda pedir ordenarAuto (radix reserva n enteros y conteo hasta 2n, por rango <= 2n)
+    std::size_t memoria = std::max<std::size_t>(config.memoriaBytes, 3 * BUFFER_MINIMO_BYTES);
+    std::size_t tamTrozo = memoria / 3 / sizeof(int);
+    int fanIn = (int)std::min<std::size_t>(FANIN_MAXIMO, std::max<std::size_t>(2, memoria / BUFFER_MINIMO_BYTES - 1));
+
+    // 0/ Fase 1: trozos ordenados en memoria
+    vector<string> corridas;
+    {
+        LectorEnteros lector(entrada, 0);
+        if (!lector.abierto())
+        {
+            r.error = "No se pudo abrir " + entrada;
+            fs::remove_all(dir, ec);
+            return r;
+        }
+
+        vector<int> trozo(tamTrozo);
+        std::size_t leidos;
+        while ((leidos = lector.leerBloque(trozo.data(), tamTrozo)) > 0)
+        {
+            MotorOrdenamiento motor = ordenarAuto(trozo.data(), (int)leidos);
+
+            string ruta = (dir / ("corrida_" + std::to_string(corridas.size()) + ".bin")).string();
+            EscritorEnteros escritor(ruta, 0);
+            escritor.escribirBloque(trozo.data(), leidos);
+            if (!escritor.cerrar())
+            {
+                r.error = "No se pudo escribir " + ruta;
+                fs::remove_all(dir, ec);
+                return r;
+            }
+            corridas.push_back(ruta);
+
+            if (config.verbose)
+                cout << "[Externo] corrida " << corridas.size() << ": " << leidos << " enteros (" << nombreMotor(motor) << ")\n";
+        }
+    }
+    r.corridas = (int)corridas.size();
+
+    // 0/ Fase 2: mezclas de a fanIn hasta que quede una sola corrida
+    int generacion = 0;
+    while (corridas.size() > 1)
+    {
+        vector<string> siguientes;
+        for (std::size_t i = 0; i < corridas.size(); i += fanIn)
+        {
+            std::size_t fin = std::min(corridas.size(), i + fanIn);
+            vector<string> grupo(corridas.begin() + i, corridas.begin() + fin);
+
+            string ruta = (dir / ("mezcla_" + std::to_string(generacion) + "_" + std::to_string(siguientes.size()) + ".bin")).string();
+            if (!mezclarCorridas(grupo, ruta, memoria))
+            {
+                r.error = "Fallo la mezcla hacia " + ruta;
+                fs::remove_all(dir, ec);
+                return r;
+            }
+            for (const string& g : grupo) fs::remove(g, ec);
+            siguientes.push_back(ruta);
+        }
+
+        if (config.verbose)
+            cout << "[Externo] pasada " << generacion + 1 << ": " << corridas.size() << " -> " << siguientes.size() << " corridas\n";
+
+        corridas.swap(siguientes);
+        generacion++;
+    }
+    r.pasadasMezcla = generacion;
+
+    // 0/ La corrida final pasa a ser la salida (copia si están en distintos volúmenes)
+    if (corridas.empty())
+    {
+        std::ofstream vacio(salida, std::ios::binary | std::ios::trunc);
+    }
+    else
+    {
+        fs::rename(corridas[0], salida, ec);
+        if (ec)
+        {
+            ec.clear();
+            fs::copy_file(corridas[0], salida, fs::copy_options::overwrite_existing, ec);
+        }
+        if (ec)
+        {
+            r.error = "No se pudo crear " + salida + ": " + ec.message();
+            fs::remove_all(dir, ec);
+            return r;
+        }
+    }
+    fs::remove_all(dir, ec);
+
+    std::chrono::duration<double> dt = std::chrono::steady_clock::now() - t0;
+    r.segundos = dt.count();
+    r.mbPorSegundo = r.segundos > 0 ? (double)bytes / (1024.0 * 1024.0) / r.segundos : 0.0;
+    r.exito = true;
+    return r;
+}
+
+bool generarArchivoBinario(const string& ruta, long long n, int minVal, int maxVal)
+{
+    if (minVal > maxVal) std::swap(minVal, maxVal);
+    std::uniform_int_distribution<int> dist(minVal, maxVal);
+
+    EscritorEnteros escritor(ruta, BUFFER_RECORRIDO);
+    if (!escritor.abierto()) return false;
+
+    for (long long i = 0; i < n; i++) escritor.agregar(dist(rngGlobal()));
+    return escritor.cerrar();
+}
+
+bool verificarArchivoOrdenado(const string& ruta, long long* elementos)
+{
+    LectorEnteros lector(ruta, BUFFER_RECORRIDO);
+    if (!lector.abierto()) return false;
+
+    long long n = 0;
+    int previo = 0, actual;
+    bool ordenado = true;
+    while (lector.siguiente(actual))
+    {
+        if (n > 0 && actual < previo) ordenado = false;
+        previo = actual;
+        n++;
+    }
+
+    if (elementos != nullptr) *elementos = n;
+    return ordenado;
+}
@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <iostream>
 #include <limits>
+#include <cmath>
 
 using std::cout;
 using std::cin;
@@ -100,7 +101,7 @@ std::vector<int> generarArregloInteractivo(int& outN)
     // Lmite de seguridad: 5 millones de elementos
     const long long LIM = 5'000'000;
     if (size > LIM) {
-        cout << "AVISO: Tamao limitado a " << LIM << " elementos\n";
+        cout << "AVISO: Tamao limitado a " << LIM << " elementos (para mas usa el ordenamiento externo)\n";
         size = LIM;
     }
 
@@ -139,4 +140,183 @@ std::vector<int> generarArregloInteractivo(int& outN)
     outN = (int)size;
     cout << "Arreglo generado con tamano: " << outN << "\n";
     return arr;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Genera un arreglo con la distribucin pedida
+ * @param n Tamao del arreglo
+ * @param d Distribucin de los valores
+ * @return std::vector<int> Vector generado
+ *
+ * @complexity O(n log n) para las variantes que parten de un arreglo ordenado, O(n) el resto
+ * @spacecomplexity O(n)
+ */
+std::vector<int> generarArregloDistribucion(int n, Distribucion d)
+{
+    std::vector<int> a;
+
+    switch (d)
+    {
+    case Distribucion::Uniforme:
+        return generarArreglo(n);
+
+    case Distribucion::Ordenado:
+        a = generarArreglo(n);
+        std::sort(a.begin(), a.end());
+        return a;
+
+    case Distribucion::CasiOrdenado:
+    {
+        // Ordenado y luego ~1% de intercambios entre vecinos cercanos (distancia <= 8)
+        a = generarArreglo(n);
+        std::sort(a.begin(), a.end());
+        if (n < 2) return a;
+        std::uniform_int_distribution<int> pos(0, n - 1);
+        std::uniform_int_distribution<int> salto(1, 8);
+        for (int k = 0; k < n / 100 + 1; k++)
+        {
+            int i = pos(rngGlobal());
+            int j = std::min(n - 1, i + salto(rngGlobal()));
+            std::swap(a[i], a[j]);
+        }
+        return a;
+    }
+
+    case Distribucion::Invertido:
+        a = generarArreglo(n);
+        std::sort(a.begin(), a.end(), [](int x, int y) { return x > y; });
+        return a;
+
+    case Distribucion::RangoEstrecho:
+        return generarArreglo(n, 0, 99);
+
+    case Distribucion::OrganPipe:
+        a.resize(n);
+        for (int i = 0; i < n; i++) a[i] = (i < n / 2) ? i : n - 1 - i;
+        return a;
+
+    case Distribucion::LotesAgregados:
+    {
+        // 90% ordenado y el resto en 8 lotes, cada uno ordenado por separado
+        a = generarArreglo(n);
+        int base = n - n / 10;
+        std::sort(a.begin(), a.begin() + base);
+        for (int k = 0; k < 8; k++)
+        {
+            int ini = base + (int)((long long)(n - base) * k / 8);
+            int fin = base + (int)((long long)(n - base) * (k + 1) / 8);
+            std::sort(a.begin() + ini, a.begin() + fin);
+        }
+        return a;
+    }
+
+    case Distribucion::Sesgada:
+    {
+        // 2^u con u uniforme en [0, 30): igual cantidad de valores en 1..2, 2..4, ..., 2^29..2^30
+        std::uniform_real_distribution<double> u(0.0, 30.0);
+        a.resize(n);
+        for (int i = 0; i < n; i++) a[i] = (int)std::exp2(u(rngGlobal()));
+        return a;
+    }
+    }
+
+    return generarArreglo(n);
+}
+
+/**
+ * @brief Nombre corto de una distribucin (para reportes y CSV)
+ * @param d Distribucin
+ * @return const char* Nombre sin espacios
+ * @complexity O(1)
+ */
+const char* nombreDistribucion(Distribucion d)
+{
+    switch (d)
+    {
+    case Distribucion::Uniforme:      return "Uniforme";
+    case Distribucion::Ordenado:      return "Ordenado";
+    case Distribucion::CasiOrdenado:  return "CasiOrdenado";
+    case Distribucion::Invertido:     return "Invertido";
+    case Distribucion::RangoEstrecho: return "RangoEstrecho";
+    case Distribucion::OrganPipe:     return "OrganPipe";
+    case Distribucion::LotesAgregados: return "LotesAgregados";
+    case Distribucion::Sesgada:       return "Sesgada";
+    }
+    return "Desconocida";
+}
+
+/**
+ * @brief Genera n cadenas aleatorias del tipo pedido (contraparte de generarArreglo)
+ * @param n Cantidad de cadenas
+ * @param tipo Forma de las cadenas
+ * @return std::vector<std::string> Cadenas generadas (pueden repetirse)
+ *
+ * @complexity O(n  L) con L el largo medio de las cadenas
+ * @spacecomplexity O(n  L)
+ */
+std::vector<std::string> generarCadenas(int n, TipoCadena tipo)
+{
+    static const char* const dominios[] = { "ejemplo", "tienda", "noticias", "universidad", "banco", "videos" };
+    static const char* const rutas[] = { "productos", "usuarios", "articulos", "categorias", "buscar", "perfil", "carrito", "api" };
+
+    std::uniform_int_distribution<int> letra('a', 'z');
+    std::uniform_int_distribution<int> largo(8, 24);
+    std::uniform_int_distribution<int> dominio(0, 5);
+    std::uniform_int_distribution<int> ruta(0, 7);
+    std::uniform_int_distribution<int> id(0, 999999);
+
+    std::vector<std::string> v;
+    v.reserve(n);
+
+    for (int i = 0; i < n; i++)
+    {
+        std::string s;
+
+        switch (tipo)
+        {
+        case TipoCadena::Aleatoria:
+        {
+            int l = largo(rngGlobal());
+            for (int k = 0; k < l; k++) s.push_back((char)letra(rngGlobal()));
+            break;
+        }
+
+        case TipoCadena::PrefijoComun:
+            s = "clientes/registro/mx";
+            for (int k = 0; k < 8; k++) s.push_back((char)letra(rngGlobal()));
+            break;
+
+        case TipoCadena::TipoUrl:
+            s = "https://www.";
+            s += dominios[dominio(rngGlobal())];
+            s += ".com/";
+            s += rutas[ruta(rngGlobal())];
+            s += "/";
+            s += rutas[ruta(rngGlobal())];
+            s += "?id=";
+            s += std::to_string(id(rngGlobal()));
+            break;
+        }
+
+        v.push_back(std::move(s));
+    }
+
+    return v;
+}
+
+/**
+ * @brief Nombre corto de un tipo de cadena (para reportes y CSV)
+ * @param tipo Tipo de cadena
+ * @return const char* Nombre sin espacios
+ * @complexity O(1)
+ */
+const char* nombreTipoCadena(TipoCadena tipo)
+{
+    switch (tipo)
+    {
+    case TipoCadena::Aleatoria:    return "Aleatoria";
+    case TipoCadena::PrefijoComun: return "PrefijoComun";
+    case TipoCadena::TipoUrl:      return "TipoUrl";
+    }
+    return "Desconocido";
+}
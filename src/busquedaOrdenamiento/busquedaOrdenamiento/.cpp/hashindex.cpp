@@ -0,0 +1,99 @@
+/**
+ * @file hashindex.cpp
+ * @brief Implementación del índice hash con sondeo lineal
+ */
+
+#include "../.h/hashindex.h"
+
+// 0/ Capacidad mínima de la tabla (con tablas chicas el costo fijo domina igual)
+static const int CAPACIDAD_MINIMA = 16;
+
+IndiceHash::IndiceHash()
+    : mascara_(0), desplazamiento_(31), claves_(0)
+{
+}
+
+IndiceHash::IndiceHash(const int* a, int n)
+    : IndiceHash()
+{
+    reconstruir(a, n);
+}
+
+// 0/ Hash multiplicativo de Fibonacci: el producto por 2^32/phi mezcla todos los bits de la
+// 0/ clave en los bits altos, que son los que se usan (claves consecutivas no chocan)
+unsigned int IndiceHash::ranuraInicial(int valor) const
+{
+    unsigned int h = (unsigned int)valor * 0x9E3779B9u;
+    return h >> desplazamiento_;
+}
+
+void IndiceHash::reconstruir(const int* a, int n)
+{
+    if (n < 0) n = 0;
+
+    // 0/ Potencia de 2 >= 2n: carga <= 0.5 aunque todos los valores sean distintos
+    int capacidad = CAPACIDAD_MINIMA;
+    int bits = 4;
+    while (capacidad < 2 * n)
+    {
+        capacidad *= 2;
+        bits++;
+    }
+
+    if ((int)tabla_.size() < capacidad)
+    {
+        tabla_.assign(capacidad, Ranura{ 0, -1 });
+    }
+    else
+    {
+        // 0/ Se reutiliza la tabla grande (no se achica al regenerar con un n menor)
+        capacidad = (int)tabla_.size();
+        bits = 0;
+        while ((1 << bits) < capacidad) bits++;
+        for (Ranura& r : tabla_) r.posicion = -1;
+    }
+
+    mascara_ = (unsigned int)capacidad - 1;
+    desplazamiento_ = 32 - bits;
+    claves_ = 0;
+
+    // 0/ Recorrido en orden: la primera inserción de cada valor es su primera posición y las
+    // 0/ apariciones siguientes no la pisan
+    for (int i = 0; i < n; i++)
+    {
+        unsigned int h = ranuraInicial(a[i]);
+
+        while (true)
+        {
+            Ranura& r = tabla_[h];
+
+            if (r.posicion < 0)
+            {
+                r.clave = a[i];
+                r.posicion = i;
+                claves_++;
+                break;
+            }
+
+            if (r.clave == a[i]) break;
+
+            h = (h + 1) & mascara_;
+        }
+    }
+}
+
+int IndiceHash::buscar(int valor) const
+{
+    if (claves_ == 0) return -1;
+
+    unsigned int h = ranuraInicial(valor);
+
+    // 0/ Carga <= 0.5: siempre hay una ranura libre que corta el sondeo de un valor ausente
+    while (true)
+    {
+        const Ranura& r = tabla_[h];
+        if (r.posicion < 0) return -1;
+        if (r.clave == valor) return r.posicion;
+        h = (h + 1) & mascara_;
+    }
+}
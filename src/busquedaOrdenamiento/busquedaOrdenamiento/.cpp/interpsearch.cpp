@@ -0,0 +1,175 @@
+/**
+ * @file interpsearch.cpp
+ * @brief Implementación de la búsqueda por interpolación, la exponencial y el índice aprendido
+ */
+
+#include "../.h/interpsearch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// 0/ Rango en el que ya no vale la pena estimar: se termina con un recorrido lineal
+static const int INTERPOLACION_LINEAL = 8;
+
+// 0/ Primera posición p en [lo, hi) con a[p] >= valor (hi si no hay)
+static int cotaInferiorRango(const int* a, int lo, int hi, int valor)
+{
+    return (int)(std::lower_bound(a + lo, a + hi, valor) - a);
+}
+
+int busquedaInterpolacion(const int* a, int n, int valor)
+{
+    // 0/ Invariante: la cota inferior de valor está en [lo, hi]
+    int lo = 0;
+    int hi = n;
+
+    while (hi - lo > INTERPOLACION_LINEAL)
+    {
+        int x0 = a[lo];
+        int x1 = a[hi - 1];
+
+        if (valor <= x0) { hi = lo; break; }
+        if (valor > x1) { lo = hi; break; }
+
+        // 0/ x0 < valor <= x1: la recta entre los extremos estima dónde está
+        double fraccion = ((double)valor - x0) / ((double)x1 - x0);
+        int p = lo + (int)(fraccion * (hi - 1 - lo));
+        if (p < lo) p = lo;
+        if (p > hi - 1) p = hi - 1;
+
+        // 0/ Con claves uniformes el error de la estimación es del orden de sqrt(largo): una
+        // 0/ segunda sonda a esa distancia, del lado correcto, suele encerrar la respuesta
+        int largoAntes = hi - lo;
+        int guarda = (int)std::sqrt((double)largoAntes);
+
+        if (a[p] < valor)
+        {
+            lo = p + 1;
+            int g = p + guarda;
+            if (g < hi)
+            {
+                if (a[g] >= valor) hi = g;
+                else               lo = g + 1;
+            }
+        }
+        else
+        {
+            hi = p;
+            int g = p - guarda;
+            if (g >= lo)
+            {
+                if (a[g] < valor) lo = g + 1;
+                else              hi = g;
+            }
+        }
+
+        // 0/ Si la estimación no partió el rango al menos a la mitad (claves no uniformes),
+        // 0/ un paso binario garantiza O(log n)
+        if (hi - lo > largoAntes / 2)
+        {
+            int m = lo + (hi - lo) / 2;
+            if (a[m] < valor) lo = m + 1;
+            else              hi = m;
+        }
+    }
+
+    while (lo < hi && a[lo] < valor) lo++;
+
+    return (lo < n && a[lo] == valor) ? lo : -1;
+}
+
+int busquedaExponencial(const int* a, int n, int valor)
+{
+    if (n <= 0) return -1;
+
+    // 0/ Se duplica el salto mientras a[limite - 1] < valor; la respuesta queda en [limite/2, limite]
+    long long limite = 1;
+    while (limite < n && a[limite - 1] < valor) limite *= 2;
+
+    int lo = (int)(limite / 2);
+    int hi = (int)std::min<long long>(limite, n);
+
+    int p = cotaInferiorRango(a, lo, hi, valor);
+    return (p < n && a[p] == valor) ? p : -1;
+}
+
+// 0/ ===================== Índice aprendido =====================
+
+IndiceAprendido::IndiceAprendido(const int* ordenado, int n, int epsilon)
+    : a_(ordenado), n_(n < 0 ? 0 : n), epsilon_(epsilon < 1 ? 1 : epsilon)
+{
+    const double infinito = std::numeric_limits<double>::infinity();
+
+    // 0/ Se modela la primera posición de cada clave distinta: es la que devuelve la búsqueda
+    int i = 0;
+    while (i < n_)
+    {
+        int x0 = a_[i];
+        int y0 = i;
+
+        // 0/ Cono de pendientes válidas: toda recta con pendiente en [menor, mayor] que pasa por
+        // 0/ (x0, y0) deja a cada punto del tramo a <= epsilon de su posición
+        double menor = 0.0;
+        double mayor = infinito;
+
+        int j = i + 1;
+        while (j < n_ && a_[j] == x0) j++;
+
+        while (j < n_)
+        {
+            double dx = (double)a_[j] - x0;
+            double minimaPunto = ((double)j - epsilon_ - y0) / dx;
+            double maximaPunto = ((double)j + epsilon_ - y0) / dx;
+
+            if (minimaPunto > mayor || maximaPunto < menor) break;
+
+            menor = std::max(menor, minimaPunto);
+            mayor = std::min(mayor, maximaPunto);
+
+            int v = a_[j];
+            while (j < n_ && a_[j] == v) j++;
+        }
+
+        claveInicio_.push_back(x0);
+        posicionInicio_.push_back(y0);
+        pendiente_.push_back(mayor == infinito ? menor : (menor + mayor) / 2.0);
+
+        i = j;
+    }
+}
+
+int IndiceAprendido::buscar(int valor) const
+{
+    if (n_ == 0 || valor < claveInicio_[0]) return -1;
+
+    // 0/ Tramo: el último cuya clave inicial es <= valor
+    int t = (int)(std::upper_bound(claveInicio_.begin(), claveInicio_.end(), valor) - claveInicio_.begin()) - 1;
+
+    double prediccion = posicionInicio_[t] + pendiente_[t] * ((double)valor - claveInicio_[t]);
+
+    // 0/ claveInicio_[t] <= valor < claveInicio_[t + 1]: la cota inferior está dentro del tramo
+    int inicioTramo = posicionInicio_[t];
+    int finTramo = (t + 1 < tramos()) ? posicionInicio_[t + 1] : n_;
+
+    // 0/ Ventana de la garantía (+1 por el redondeo), recortada al tramo
+    long long lo = (long long)std::floor(prediccion) - epsilon_ - 1;
+    long long hi = (long long)std::ceil(prediccion) + epsilon_ + 2;
+    if (lo < inicioTramo) lo = inicioTramo;
+    if (hi > finTramo) hi = finTramo;
+    if (lo > hi) lo = hi;
+
+    int p = cotaInferiorRango(a_, (int)lo, (int)hi, valor);
+
+    // 0/ La garantía vale para las claves presentes. Un valor ausente más allá de la última clave
+    // 0/ del tramo puede caer fuera de la ventana: entonces se busca en el tramo entero
+    bool valida = (p == inicioTramo || a_[p - 1] < valor) && (p == finTramo || a_[p] >= valor);
+    if (!valida) p = cotaInferiorRango(a_, inicioTramo, finTramo, valor);
+
+    return (p < n_ && a_[p] == valor) ? p : -1;
+}
+
+long long IndiceAprendido::bytesModelo() const
+{
+    return (long long)claveInicio_.size() * (sizeof(int) + sizeof(int) + sizeof(double));
+}
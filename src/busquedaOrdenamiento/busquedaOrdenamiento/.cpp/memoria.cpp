@@ -0,0 +1,100 @@
+/**
+ * @file memoria.cpp
+ * @brief Reemplazo de los operator new / delete globales con contador de bytes y pico
+ */
+
+#include "../.h/memoria.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// 0/ Cada bloque lleva delante su tamaño; el encabezado ocupa una alineación completa
+// 0/ para que el puntero devuelto conserve la alineación de malloc
+static const std::size_t ENCABEZADO = alignof(std::max_align_t);
+
+static std::atomic<std::size_t> enUso(0);
+static std::atomic<std::size_t> pico(0);
+static std::atomic<std::size_t> lineaBase(0);
+
+static void* reservarContado(std::size_t tam)
+{
+    if (tam == 0) tam = 1;
+
+    void* bloque;
+    while ((bloque = std::malloc(tam + ENCABEZADO)) == nullptr)
+    {
+        std::new_handler h = std::get_new_handler();
+        if (h == nullptr) return nullptr;
+        h();
+    }
+
+    *static_cast<std::size_t*>(bloque) = tam;
+
+    std::size_t actual = enUso.fetch_add(tam) + tam;
+    std::size_t previo = pico.load();
+    while (actual > previo && !pico.compare_exchange_weak(previo, actual))
+    {
+    }
+
+    return static_cast<char*>(bloque) + ENCABEZADO;
+}
+
+static void liberarContado(void* p) noexcept
+{
+    if (p == nullptr) return;
+
+    void* bloque = static_cast<char*>(p) - ENCABEZADO;
+    enUso.fetch_sub(*static_cast<std::size_t*>(bloque));
+    std::free(bloque);
+}
+
+std::size_t memoriaEnUso()
+{
+    return enUso.load();
+}
+
+void memoriaReiniciarPico()
+{
+    std::size_t actual = enUso.load();
+    lineaBase.store(actual);
+    pico.store(actual);
+}
+
+std::size_t memoriaPicoExtra()
+{
+    std::size_t p = pico.load();
+    std::size_t b = lineaBase.load();
+    return p > b ? p - b : 0;
+}
+
+void* operator new(std::size_t tam)
+{
+    void* p = reservarContado(tam);
+    if (p == nullptr) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](std::size_t tam)
+{
+    void* p = reservarContado(tam);
+    if (p == nullptr) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new(std::size_t tam, const std::nothrow_t&) noexcept
+{
+    return reservarContado(tam);
+}
+
+void* operator new[](std::size_t tam, const std::nothrow_t&) noexcept
+{
+    return reservarContado(tam);
+}
+
+void operator delete(void* p) noexcept { liberarContado(p); }
+void operator delete[](void* p) noexcept { liberarContado(p); }
+void operator delete(void* p, std::size_t) noexcept { liberarContado(p); }
+void operator delete[](void* p, std::size_t) noexcept { liberarContado(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { liberarContado(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { liberarContado(p); }
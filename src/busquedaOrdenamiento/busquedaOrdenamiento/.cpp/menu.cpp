@@ -7,6 +7,8 @@
 #include "../.h/menu.h"
 #include "../.h/search.h"
 #include "../.h/sort.h"
+#include "../.h/select.h"
+#include "../.h/externalsort.h"
 #include "../.h/generator.h"
 #include "../.h/benchmark.h"
 
@@ -27,11 +29,11 @@ using std::string;
 void ejecutarMenuPrincipal()
 {
     int opcion;
-    vector<int> arregloVec;
+    ConjuntoDatos datos;
     int n = 0;
     bool verbose = false;
 
-    arregloVec = generarArregloInteractivo(n);
+    datos.reemplazar(generarArregloInteractivo(n));
 
     do
     {
@@ -41,26 +43,34 @@ void ejecutarMenuPrincipal()
         switch (opcion)
         {
         case 0:
-            manejarRegeneracion(arregloVec, n, verbose);
+            manejarRegeneracion(datos, verbose);
             break;
 
         case 1:
-            manejarBusquedaSecuencial(arregloVec, n, verbose);
+            manejarBusquedaSecuencial(datos, verbose);
             break;
 
         case 2:
-            manejarBusquedaBinaria(arregloVec, n, verbose);
+            manejarBusquedaBinaria(datos, verbose);
             break;
 
         case 3:
-            manejarOrdenamiento(arregloVec, n, verbose);
+            manejarOrdenamiento(datos, verbose);
             break;
 
         case 4:
-            manejarBenchmarks();
+            manejarSeleccion(datos, verbose);
             break;
 
         case 5:
+            manejarOrdenamientoExterno(verbose);
+            break;
+
+        case 6:
+            manejarBenchmarks();
+            break;
+
+        case 7:
             cout << "Saliendo...\n";
             break;
 
@@ -68,15 +78,16 @@ void ejecutarMenuPrincipal()
             cout << "Opcion invalida.\n";
         }
 
-    } while (opcion != 5);
+    } while (opcion != 7);
 }
 
 /**
  * @brief Implementacin de manejarRegeneracion
  */
-void manejarRegeneracion(vector<int>& arregloVec, int& n, bool& verbose)
+void manejarRegeneracion(ConjuntoDatos& datos, bool& verbose)
 {
-    arregloVec = generarArregloInteractivo(n);
+    int n = 0;
+    datos.reemplazar(generarArregloInteractivo(n));
     cout << "Mostrar proceso paso a paso? (1=Si / 0=No): ";
     cin >> verbose;
 }
@@ -84,11 +95,11 @@ void manejarRegeneracion(vector<int>& arregloVec, int& n, bool& verbose)
 /**
  * @brief Implementacin de manejarBusquedaSecuencial
  */
-void manejarBusquedaSecuencial(const vector<int>& arregloVec, int n, bool verbose)
+void manejarBusquedaSecuencial(const ConjuntoDatos& datos, bool verbose)
 {
-    mostrarArreglo(arregloVec.data(), n);
+    mostrarArreglo(datos.datos().data(), datos.tamano());
     int valor = pedirValor();
-    int posicion = busquedaSecuencial(arregloVec.data(), n, valor, verbose);
+    int posicion = busquedaSecuencial(datos.datos().data(), datos.tamano(), valor, verbose);
 
     if (posicion != -1)
         cout << "Valor encontrado en posicion: " << posicion << endl;
@@ -98,15 +109,24 @@ void manejarBusquedaSecuencial(const vector<int>& arregloVec, int n, bool verbos
 
 /**
  * @brief Implementacin de manejarBusquedaBinaria
+ * @details Busca en la versin ordenada del conjunto: slo se ordena (con ordenarAuto) la
+ *          primera vez despus de un cambio de datos; las posiciones son las del arreglo ordenado
  */
-void manejarBusquedaBinaria(vector<int>& arregloVec, int n, bool verbose)
+void manejarBusquedaBinaria(ConjuntoDatos& datos, bool verbose)
 {
-    cout << "\nOrdenando arreglo con burbuja...\n";
-    ordenarBurbuja(arregloVec.data(), n, verbose);
-    mostrarArreglo(arregloVec.data(), n);
+    if (datos.estaOrdenado())
+        cout << "\nEl arreglo ya esta ordenado.\n";
+    else if (datos.hayCopiaOrdenada())
+        cout << "\nUsando la copia ordenada guardada.\n";
+    else
+        cout << "\nOrdenando una copia del arreglo (se reutiliza hasta que cambien los datos)...\n";
+
+    const vector<int>& ordenado = datos.ordenado();
+    int n = (int)ordenado.size();
+    mostrarArreglo(ordenado.data(), n);
 
     int valor = pedirValor();
-    int posicion = busquedaBinaria(arregloVec.data(), n, valor, verbose);
+    int posicion = busquedaBinaria(ordenado.data(), n, valor, verbose);
 
     if (posicion != -1)
         cout << "Valor encontrado en posicion: " << posicion << endl;
@@ -117,8 +137,11 @@ void manejarBusquedaBinaria(vector<int>& arregloVec, int n, bool verbose)
 /**
  * @brief Implementacin de manejarOrdenamiento
  */
-void manejarOrdenamiento(vector<int>& arregloVec, int n, bool verbose)
+void manejarOrdenamiento(ConjuntoDatos& datos, bool verbose)
 {
+    // 0/ Cualquier mtodo reescribe los datos: se descarta la copia ordenada y el estado de orden
+    vector<int>& arregloVec = datos.modificar();
+    int n = (int)arregloVec.size();
     int metodo = mostrarMenuOrdenamiento();
     int comparaciones = 0;
     int intercambios = 0;
@@ -146,6 +169,55 @@ void manejarOrdenamiento(vector<int>& arregloVec, int n, bool verbose)
         mergeSort(arregloVec.data(), 0, n - 1, comparaciones, verbose);
         cout << "Comparaciones: " << comparaciones << endl;
     }
+    else if (metodo == 6)
+    {
+        mergeSortParalelo(arregloVec.data(), 0, n - 1, comparaciones);
+        cout << "Comparaciones: " << comparaciones << endl;
+    }
+    else if (metodo == 7)
+    {
+        mergeSortIterativo(arregloVec.data(), n, comparaciones, nullptr, verbose);
+        cout << "Comparaciones: " << comparaciones << endl;
+    }
+    else if (metodo == 8)
+    {
+        introSort(arregloVec.data(), 0, n - 1, comparaciones, intercambios, verbose);
+        cout << "Comparaciones: " << comparaciones << endl;
+        cout << "Intercambios: " << intercambios << endl;
+    }
+    else if (metodo == 9)
+    {
+        quickSortBloques(arregloVec.data(), 0, n - 1, comparaciones, intercambios, verbose);
+        cout << "Comparaciones: " << comparaciones << endl;
+        cout << "Intercambios: " << intercambios << endl;
+    }
+    else if (metodo == 10)
+    {
+        ordenarRadix(arregloVec.data(), n, verbose);
+    }
+    else if (metodo == 11)
+    {
+        sampleSortParalelo(arregloVec.data(), n);
+    }
+    else if (metodo == 12)
+    {
+        PerfilArreglo perfil;
+        ordenarAuto(arregloVec.data(), n, &perfil);
+        cout << "Corridas ascendentes: " << perfil.corridas << endl;
+        cout << "Rango: " << perfil.minimo << " .. " << perfil.maximo << endl;
+        cout << "Duplicados (muestra): " << perfil.ratioDuplicados * 100.0 << "%" << endl;
+        cout << "Motor elegido: " << nombreMotor(perfil.motor) << endl;
+    }
+    else if (metodo == 13)
+    {
+        ordenarTimsort(arregloVec.data(), n, comparaciones, verbose);
+        cout << "Comparaciones: " << comparaciones << endl;
+    }
+    else if (metodo == 14)
+    {
+        mergeSortBajaMemoria(arregloVec.data(), n, comparaciones, verbose);
+        cout << "Comparaciones: " << comparaciones << endl;
+    }
     else
     {
         cout << "Metodo invalido.\n";
@@ -155,6 +227,120 @@ void manejarOrdenamiento(vector<int>& arregloVec, int n, bool verbose)
     mostrarArreglo(arregloVec.data(), n);
 }
 
+/**
+ * @brief Implementacin de manejarSeleccion
+ * @details Trabaja sobre una copia: el arreglo del usuario no cambia de orden
+ */
+void manejarSeleccion(const ConjuntoDatos& datos, bool verbose)
+{
+    const vector<int>& arregloVec = datos.datos();
+    int n = datos.tamano();
+    int metodo = mostrarMenuSeleccion();
+    if (metodo < 1 || metodo > 3)
+    {
+        cout << "Metodo invalido.\n";
+        return;
+    }
+    if (n == 0)
+    {
+        cout << "El arreglo esta vacio.\n";
+        return;
+    }
+
+    cout << "Ingresa k (1-" << n << "): ";
+    int k;
+    cin >> k;
+    if (k < 1 || k > n)
+    {
+        cout << "k fuera de rango.\n";
+        return;
+    }
+
+    vector<int> copia = arregloVec;
+    int comparaciones = 0;
+    int intercambios = 0;
+
+    if (metodo == 1)
+    {
+        int valor = seleccionarK(copia.data(), n, k - 1, comparaciones, intercambios, verbose);
+        cout << "El " << k << "-esimo menor es: " << valor << endl;
+        cout << "Comparaciones: " << comparaciones << endl;
+        cout << "Intercambios: " << intercambios << endl;
+    }
+    else if (metodo == 2)
+    {
+        ordenarParcial(copia.data(), n, k, comparaciones, intercambios, verbose);
+        cout << "Los " << k << " menores, ordenados:\n";
+        mostrarArreglo(copia.data(), k);
+        cout << "Comparaciones: " << comparaciones << endl;
+        cout << "Intercambios: " << intercambios << endl;
+    }
+    else
+    {
+        vector<int> mayores = topK(arregloVec.data(), n, k, comparaciones);
+        cout << "Los " << k << " mayores, de mayor a menor:\n";
+        mostrarArreglo(mayores.data(), (int)mayores.size());
+        cout << "Comparaciones: " << comparaciones << endl;
+    }
+}
+
+/**
+ * @brief Implementacin de manejarOrdenamientoExterno
+ * @details El resultado se escribe junto a la entrada con el sufijo ".ordenado"
+ */
+void manejarOrdenamientoExterno(bool verbose)
+{
+    cout << "\n=== ORDENAMIENTO EXTERNO (archivo binario de int32) ===\n";
+    cout << "1) Generar archivo aleatorio y ordenarlo\n";
+    cout << "2) Ordenar un archivo existente\n";
+    cout << "Elige opcion (1-2): ";
+    int modo;
+    cin >> modo;
+    if (modo != 1 && modo != 2)
+    {
+        cout << "Opcion invalida.\n";
+        return;
+    }
+
+    string ruta;
+    cout << "Ruta del archivo: ";
+    cin >> ruta;
+
+    if (modo == 1)
+    {
+        long long cantidad;
+        cout << "Cantidad de enteros (sin limite de memoria): ";
+        cin >> cantidad;
+        if (cantidad < 0 || !generarArchivoBinario(ruta, cantidad, 0, 2'000'000'000))
+        {
+            cout << "No se pudo generar el archivo.\n";
+            return;
+        }
+        cout << "Archivo generado: " << cantidad * 4 / (1024 * 1024) << " MB\n";
+    }
+
+    ConfigOrdenamientoExterno config;
+    int megas;
+    cout << "Memoria disponible en MB (>= 1): ";
+    cin >> megas;
+    config.memoriaBytes = (std::size_t)(megas < 1 ? 1 : megas) << 20;
+    config.verbose = verbose;
+
+    string salida = ruta + ".ordenado";
+    ResultadoOrdenamientoExterno r = ordenarArchivoExterno(ruta, salida, config);
+    if (!r.exito)
+    {
+        cout << "Error: " << r.error << endl;
+        return;
+    }
+
+    cout << "Salida: " << salida << endl;
+    cout << "Elementos: " << r.elementos << endl;
+    cout << "Corridas iniciales: " << r.corridas << ", pasadas de mezcla: " << r.pasadasMezcla << endl;
+    cout << "Tiempo: " << r.segundos << " s (" << r.mbPorSegundo << " MB/s)" << endl;
+    cout << "Verificacion: " << (verificarArchivoOrdenado(salida) ? "ordenado" : "NO ordenado") << endl;
+}
+
 /**
  * @brief Implementacin de manejarBenchmarks
  */
@@ -172,17 +358,19 @@ void mostrarMenu()
     cout << "\n=== MENU PRINCIPAL ===\n";
     cout << "0) Regenerar arreglo\n";
     cout << "1) Busqueda Secuencial\n";
-    cout << "2) Busqueda Binaria (con ordenamiento burbuja)\n";
+    cout << "2) Busqueda Binaria (ordena una copia una sola vez)\n";
     cout << "3) Ordenamiento\n";
-    cout << "4) Benchmarks automaticos\n";
-    cout << "5) Salir\n";
+    cout << "4) Seleccion (k-esimo, k menores, k mayores)\n";
+    cout << "5) Ordenamiento externo (archivos mas grandes que la memoria)\n";
+    cout << "6) Benchmarks automaticos\n";
+    cout << "7) Salir\n";
     cout << "Elige opcion: ";
 }
 
 /**
  * @brief Implementacin de mostrarMenuOrdenamiento
  * @brief Muestra el submen de mtodos de ordenamiento
- * @return int Opcin seleccionada por el usuario (1-5)
+ * @return int Opcin seleccionada por el usuario (1-14)
  */
 int mostrarMenuOrdenamiento()
 {
@@ -192,7 +380,34 @@ int mostrarMenuOrdenamiento()
     cout << "3) Insercion\n";
     cout << "4) QuickSort\n";
     cout << "5) MergeSort\n";
-    cout << "Elige metodo (1-5): ";
+    cout << "6) MergeSort paralelo\n";
+    cout << "7) MergeSort iterativo (sin reservas por merge)\n";
+    cout << "8) IntroSort (QuickSort sin peor caso cuadratico)\n";
+    cout << "9) QuickSort por bloques (particion sin saltos)\n";
+    cout << "10) Radix (sin comparaciones)\n";
+    cout << "11) Sample sort paralelo\n";
+    cout << "12) Automatico (elige segun los datos)\n";
+    cout << "13) Timsort (aprovecha corridas ya ordenadas)\n";
+    cout << "14) MergeSort de poca memoria (estable, buffer de raiz de n)\n";
+    cout << "Elige metodo (1-14): ";
+
+    int metodo;
+    cin >> metodo;
+    return metodo;
+}
+
+/**
+ * @brief Implementacin de mostrarMenuSeleccion
+ * @brief Muestra el submen de seleccin
+ * @return int Opcin seleccionada por el usuario (1-3)
+ */
+int mostrarMenuSeleccion()
+{
+    cout << "\n=== SELECCION ===\n";
+    cout << "1) k-esimo menor (introselect)\n";
+    cout << "2) Ordenar solo los k menores\n";
+    cout << "3) k mayores (monticulo)\n";
+    cout << "Elige metodo (1-3): ";
 
     int metodo;
     cin >> metodo;
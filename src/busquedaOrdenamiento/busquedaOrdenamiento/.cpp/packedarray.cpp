@@ -0,0 +1,193 @@
+/**
+ * @file packedarray.cpp
+ * @brief Implementación del arreglo ordenado comprimido por bloques
+ */
+
+#include "../.h/packedarray.h"
+#include "../.h/simd.h"
+
+#include <algorithm>
+
+// 0/ Cada bloque son 4 carriles de 32 valores; el valor i va al carril i % 4
+static const int CARRILES = 4;
+static const int VALORES_POR_CARRIL = VALORES_POR_BLOQUE / CARRILES;
+
+// 0/ Bits necesarios para representar x (0 para x == 0)
+static int anchoBits(std::uint32_t x)
+{
+    int w = 0;
+    while (w < 32 && (x >> w) != 0) w++;
+    return w;
+}
+
+// 0/ Empaqueta 128 distancias a la cabeza con w bits cada una. La palabra j del carril l queda en
+// 0/ palabras[4·j + l]: las 4 palabras j de los carriles son contiguas y se leen juntas
+static void empaquetarBloque(const std::uint32_t* distancias, int w, std::uint32_t* palabras)
+{
+    for (int i = 0; i < CARRILES * w; i++) palabras[i] = 0;
+    if (w == 0) return;
+
+    for (int l = 0; l < CARRILES; l++)
+    {
+        for (int k = 0; k < VALORES_POR_CARRIL; k++)
+        {
+            std::uint32_t x = distancias[k * CARRILES + l];
+            int bit = k * w;
+            int palabra = bit >> 5;
+            int corrimiento = bit & 31;
+
+            palabras[palabra * CARRILES + l] |= x << corrimiento;
+            if (corrimiento + w > 32)
+                palabras[(palabra + 1) * CARRILES + l] |= x >> (32 - corrimiento);
+        }
+    }
+}
+
+// 0/ Inversa de empaquetarBloque sumando la cabeza: salida queda en el orden original
+static void desempaquetarBloque(const std::uint32_t* palabras, int w, int cabeza, int* salida)
+{
+    if (w == 0)
+    {
+        for (int i = 0; i < VALORES_POR_BLOQUE; i++) salida[i] = cabeza;
+        return;
+    }
+
+#if defined(SIMD_SSE2)
+    // 0/ El corrimiento es el mismo en los 4 carriles, así que alcanza con los shifts de SSE2
+    // 0/ de cantidad uniforme; cada iteración produce salida[4k .. 4k+3]
+    const __m128i mascara = _mm_set1_epi32(w == 32 ? -1 : (int)((1u << w) - 1));
+    const __m128i base = _mm_set1_epi32(cabeza);
+
+    for (int k = 0; k < VALORES_POR_CARRIL; k++)
+    {
+        int bit = k * w;
+        int palabra = bit >> 5;
+        int corrimiento = bit & 31;
+
+        __m128i v = _mm_loadu_si128((const __m128i*)(palabras + palabra * CARRILES));
+        v = _mm_srl_epi32(v, _mm_cvtsi32_si128(corrimiento));
+        if (corrimiento + w > 32)
+        {
+            __m128i alta = _mm_loadu_si128((const __m128i*)(palabras + (palabra + 1) * CARRILES));
+            v = _mm_or_si128(v, _mm_sll_epi32(alta, _mm_cvtsi32_si128(32 - corrimiento)));
+        }
+        v = _mm_add_epi32(_mm_and_si128(v, mascara), base);
+        _mm_storeu_si128((__m128i*)(salida + k * CARRILES), v);
+    }
+#else
+    const std::uint32_t mascara = w == 32 ? 0xFFFFFFFFu : ((1u << w) - 1);
+
+    for (int k = 0; k < VALORES_POR_CARRIL; k++)
+    {
+        int bit = k * w;
+        int palabra = bit >> 5;
+        int corrimiento = bit & 31;
+
+        for (int l = 0; l < CARRILES; l++)
+        {
+            std::uint32_t x = palabras[palabra * CARRILES + l] >> corrimiento;
+            if (corrimiento + w > 32)
+                x |= palabras[(palabra + 1) * CARRILES + l] << (32 - corrimiento);
+            salida[k * CARRILES + l] = (int)((x & mascara) + (std::uint32_t)cabeza);
+        }
+    }
+#endif
+}
+
+ArregloComprimido::ArregloComprimido(const int* ordenado, int n)
+    : n_(n < 0 ? 0 : n)
+{
+    int numBloques = (n_ + VALORES_POR_BLOQUE - 1) / VALORES_POR_BLOQUE;
+    cabezas_.reserve(numBloques);
+    anchos_.reserve(numBloques);
+    inicios_.reserve(numBloques);
+
+    std::uint32_t distancias[VALORES_POR_BLOQUE];
+
+    for (int b = 0; b < numBloques; b++)
+    {
+        int inicio = b * VALORES_POR_BLOQUE;
+        int cuenta = std::min(VALORES_POR_BLOQUE, n_ - inicio);
+        int cabeza = ordenado[inicio];
+
+        // 0/ Resta sin signo: el rango de un bloque puede pasar de INT_MAX
+        for (int i = 0; i < cuenta; i++)
+            distancias[i] = (std::uint32_t)ordenado[inicio + i] - (std::uint32_t)cabeza;
+
+        // 0/ El último bloque se completa con su mayor valor (no cambia el ancho)
+        for (int i = cuenta; i < VALORES_POR_BLOQUE; i++)
+            distancias[i] = distancias[cuenta - 1];
+
+        // 0/ Ordenado: la mayor distancia es la del último valor
+        int w = anchoBits(distancias[VALORES_POR_BLOQUE - 1]);
+
+        cabezas_.push_back(cabeza);
+        anchos_.push_back((std::uint8_t)w);
+        inicios_.push_back((std::uint32_t)datos_.size());
+
+        datos_.resize(datos_.size() + (size_t)CARRILES * w);
+        empaquetarBloque(distancias, w, datos_.data() + inicios_.back());
+    }
+}
+
+int ArregloComprimido::decodificarBloque(int bloque, int* salida) const
+{
+    desempaquetarBloque(datos_.data() + inicios_[bloque], anchos_[bloque], cabezas_[bloque], salida);
+    return std::min(VALORES_POR_BLOQUE, n_ - bloque * VALORES_POR_BLOQUE);
+}
+
+int ArregloComprimido::buscar(int valor) const
+{
+    if (n_ == 0) return -1;
+
+    // 0/ j = primer bloque con cabeza >= valor. La primera aparición está en el bloque j - 1
+    // 0/ (si alguna cabeza anterior es < valor) o es la cabeza del bloque j
+    int j = (int)(std::lower_bound(cabezas_.begin(), cabezas_.end(), valor) - cabezas_.begin());
+
+    if (j > 0)
+    {
+        alignas(16) int bloque[VALORES_POR_BLOQUE];
+        int cuenta = decodificarBloque(j - 1, bloque);
+
+        int p = (int)(std::lower_bound(bloque, bloque + cuenta, valor) - bloque);
+        if (p < cuenta) return bloque[p] == valor ? (j - 1) * VALORES_POR_BLOQUE + p : -1;
+    }
+
+    if (j < bloques() && cabezas_[j] == valor) return j * VALORES_POR_BLOQUE;
+    return -1;
+}
+
+void ArregloComprimido::descomprimir(int* salida) const
+{
+    int completos = n_ / VALORES_POR_BLOQUE;
+    for (int b = 0; b < completos; b++)
+        decodificarBloque(b, salida + b * VALORES_POR_BLOQUE);
+
+    if (completos < bloques())
+    {
+        int resto[VALORES_POR_BLOQUE];
+        int cuenta = decodificarBloque(completos, resto);
+        std::copy(resto, resto + cuenta, salida + completos * VALORES_POR_BLOQUE);
+    }
+}
+
+long long ArregloComprimido::bytes() const
+{
+    return (long long)datos_.size() * sizeof(std::uint32_t)
+        + (long long)cabezas_.size() * (sizeof(int) + sizeof(std::uint8_t) + sizeof(std::uint32_t));
+}
+
+double ArregloComprimido::razonCompresion() const
+{
+    long long b = bytes();
+    return b > 0 ? (double)n_ * sizeof(int) / b : 1.0;
+}
+
+const char* ArregloComprimido::nivelDesempaquetado()
+{
+#if defined(SIMD_SSE2)
+    return "SSE2";
+#else
+    return "Escalar";
+#endif
+}
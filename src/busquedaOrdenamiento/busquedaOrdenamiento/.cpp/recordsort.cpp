@@ -0,0 +1,237 @@
+/**
+ * @file recordsort.cpp
+ * @brief Implementación de argsort estable (radix LSD) e inestable (introsort sobre pares)
+ */
+
+#include "../.h/recordsort.h"
+
+#include <vector>
+
+using std::vector;
+
+// 0/ Mismos dígitos que ordenarRadix: 3 pasadas de 11 bits
+static const int REG_RADIX_BITS = 11;
+static const int REG_RADIX_CUBETAS = 1 << REG_RADIX_BITS;
+static const int REG_RADIX_PASADAS = 3;
+// 0/ Por debajo de esto la inserción le gana al costo fijo de los histogramas
+static const int REG_UMBRAL_RADIX = 256;
+static const int REG_UMBRAL_INSERCION = 16;
+
+struct ParClave
+{
+    int clave;
+    int indice;
+};
+
+static inline unsigned claveSinSigno(int x)
+{
+    return (unsigned)x ^ 0x80000000u;
+}
+
+// 0/ Inserción estable sobre las dos columnas
+static void insercionColumnas(int* claves, int* indices, int n)
+{
+    for (int i = 1; i < n; i++)
+    {
+        int c = claves[i];
+        int x = indices[i];
+        int j = i - 1;
+        while (j >= 0 && claves[j] > c)
+        {
+            claves[j + 1] = claves[j];
+            indices[j + 1] = indices[j];
+            j--;
+        }
+        claves[j + 1] = c;
+        indices[j + 1] = x;
+    }
+}
+
+// 0/ Radix LSD: cada pasada es estable, así que claves iguales quedan en el orden de entrada
+static void radixColumnas(int* claves, int* indices, int n)
+{
+    vector<int> conteo(REG_RADIX_PASADAS * REG_RADIX_CUBETAS, 0);
+    for (int i = 0; i < n; i++)
+    {
+        unsigned u = claveSinSigno(claves[i]);
+        for (int p = 0; p < REG_RADIX_PASADAS; p++)
+            conteo[p * REG_RADIX_CUBETAS + ((u >> (p * REG_RADIX_BITS)) & (REG_RADIX_CUBETAS - 1))]++;
+    }
+
+    vector<int> bufClaves;
+    vector<int> bufIndices;
+    int* origenC = claves;
+    int* origenI = indices;
+    int* destinoC = nullptr;
+    int* destinoI = nullptr;
+
+    for (int p = 0; p < REG_RADIX_PASADAS; p++)
+    {
+        int desplazamiento = p * REG_RADIX_BITS;
+        int* c = &conteo[p * REG_RADIX_CUBETAS];
+
+        unsigned digitoPrimero = (claveSinSigno(origenC[0]) >> desplazamiento) & (REG_RADIX_CUBETAS - 1);
+        if (c[digitoPrimero] == n) continue;
+
+        if (destinoC == nullptr)
+        {
+            bufClaves.resize(n);
+            bufIndices.resize(n);
+            destinoC = bufClaves.data();
+            destinoI = bufIndices.data();
+        }
+
+        int suma = 0;
+        for (int d = 0; d < REG_RADIX_CUBETAS; d++)
+        {
+            int t = c[d];
+            c[d] = suma;
+            suma += t;
+        }
+
+        for (int i = 0; i < n; i++)
+        {
+            unsigned d = (claveSinSigno(origenC[i]) >> desplazamiento) & (REG_RADIX_CUBETAS - 1);
+            int pos = c[d]++;
+            destinoC[pos] = origenC[i];
+            destinoI[pos] = origenI[i];
+        }
+
+        int* t = origenC; origenC = destinoC; destinoC = t;
+        t = origenI; origenI = destinoI; destinoI = t;
+    }
+
+    if (origenC != claves)
+    {
+        for (int k = 0; k < n; k++)
+        {
+            claves[k] = origenC[k];
+            indices[k] = origenI[k];
+        }
+    }
+}
+
+static void intercambiarPares(ParClave* a, int i, int j)
+{
+    ParClave t = a[i];
+    a[i] = a[j];
+    a[j] = t;
+}
+
+static void hundirPares(ParClave* a, int i, int n)
+{
+    ParClave v = a[i];
+    while (true)
+    {
+        int hijo = 2 * i + 1;
+        if (hijo >= n) break;
+        if (hijo + 1 < n && a[hijo + 1].clave > a[hijo].clave) hijo++;
+        if (a[hijo].clave <= v.clave) break;
+        a[i] = a[hijo];
+        i = hijo;
+    }
+    a[i] = v;
+}
+
+// 0/ IntroSort sobre pares [izquierda, derecha]: los pares se mueven juntos, un solo acceso por registro
+static void introSortPares(ParClave* a, int izquierda, int derecha, int profundidad)
+{
+    while (derecha - izquierda + 1 > REG_UMBRAL_INSERCION)
+    {
+        if (profundidad-- == 0)
+        {
+            int n = derecha - izquierda + 1;
+            ParClave* b = a + izquierda;
+            for (int i = n / 2 - 1; i >= 0; i--) hundirPares(b, i, n);
+            for (int fin = n - 1; fin > 0; fin--)
+            {
+                intercambiarPares(b, 0, fin);
+                hundirPares(b, 0, fin);
+            }
+            return;
+        }
+
+        int medio = izquierda + (derecha - izquierda) / 2;
+        if (a[medio].clave < a[izquierda].clave) intercambiarPares(a, medio, izquierda);
+        if (a[derecha].clave < a[medio].clave)
+        {
+            intercambiarPares(a, derecha, medio);
+            if (a[medio].clave < a[izquierda].clave) intercambiarPares(a, medio, izquierda);
+        }
+        int pivote = a[medio].clave;
+
+        int i = izquierda;
+        int j = derecha;
+        while (i <= j)
+        {
+            while (a[i].clave < pivote) i++;
+            while (a[j].clave > pivote) j--;
+            if (i <= j)
+            {
+                intercambiarPares(a, i, j);
+                i++;
+                j--;
+            }
+        }
+
+        // 0/ Recursión sobre el lado menor, bucle sobre el mayor
+        if (j - izquierda < derecha - i)
+        {
+            if (izquierda < j) introSortPares(a, izquierda, j, profundidad);
+            izquierda = i;
+        }
+        else
+        {
+            if (i < derecha) introSortPares(a, i, derecha, profundidad);
+            derecha = j;
+        }
+    }
+
+    for (int i = izquierda + 1; i <= derecha; i++)
+    {
+        ParClave v = a[i];
+        int j = i - 1;
+        while (j >= izquierda && a[j].clave > v.clave)
+        {
+            a[j + 1] = a[j];
+            j--;
+        }
+        a[j + 1] = v;
+    }
+}
+
+void ordenarClavesConIndices(int* claves, int* indices, int n, ModoOrdenRegistros modo)
+{
+    if (n < 2) return;
+
+    if (modo == ModoOrdenRegistros::Estable)
+    {
+        if (n < REG_UMBRAL_RADIX) insercionColumnas(claves, indices, n);
+        else                      radixColumnas(claves, indices, n);
+        return;
+    }
+
+    // 0/ Inestable: se ordenan pares contiguos y luego se separan de nuevo en columnas
+    vector<ParClave> pares(n);
+    for (int i = 0; i < n; i++) pares[i] = { claves[i], indices[i] };
+
+    int profundidad = 0;
+    for (int m = n; m > 1; m >>= 1) profundidad += 2;
+    introSortPares(pares.data(), 0, n - 1, profundidad);
+
+    for (int i = 0; i < n; i++)
+    {
+        claves[i] = pares[i].clave;
+        indices[i] = pares[i].indice;
+    }
+}
+
+vector<int> argsort(const int* claves, int n, ModoOrdenRegistros modo)
+{
+    vector<int> copia(claves, claves + n);
+    vector<int> permutacion(n);
+    for (int i = 0; i < n; i++) permutacion[i] = i;
+
+    ordenarClavesConIndices(copia.data(), permutacion.data(), n, modo);
+    return permutacion;
+}
@@ -1,36 +1,30 @@
 #include "../.h/search.h"
+#include "../.h/sortcore.h"
+#include "../.h/searchsimd.h"
 #include <iostream>
 
 using namespace std;
 
 int busquedaSecuencial(const int* arr, int n, int valor, bool verbose)
 {
-    // tu implementacin aqu (no debe modificar arr[])
-    for (int i = 0; i < n; i++) {
-        if (arr[i] == valor) return i;  // lectura solo, no modifica
-    }
-    return -1;
+    // 0/ Recorre sin modificar arr[]. No imprime nada ni con verbose: una lnea por elemento
+    // 0/ inundara la consola con los tamaos del men
+    (void)verbose;
+
+    // 0/ Se compara de a 8 (AVX2) o 4 (SSE2) enteros por instruccin
+    return buscarPrimeroSimd(arr, n, valor);
 }
 
 
-int busquedaBinaria(int arreglo[], int n, int valor, bool verbose)
+int busquedaBinaria(const int arreglo[], int n, int valor, bool verbose)
 {
     // 0/ Busca dividiendo el rango (requiere arreglo ordenado)
-    int izquierda = 0;
-    int derecha = n - 1;
-
-    while (izquierda <= derecha)
+    if (verbose)
     {
-        int medio = (izquierda + derecha) / 2;
-
-        if (verbose)
-            cout << "[Binaria] izq=" << izquierda << " der=" << derecha
-                 << " medio=" << medio << " valMedio=" << arreglo[medio] << "\n";
-
-        if (arreglo[medio] == valor) return medio;
-        else if (arreglo[medio] < valor) izquierda = medio + 1;
-        else derecha = medio - 1;
+        nucleo::Traza pol;
+        return nucleo::busquedaBinaria(arreglo, n, valor, less<int>(), pol);
     }
 
-    return -1;
+    nucleo::Silenciosa pol;
+    return nucleo::busquedaBinaria(arreglo, n, valor, less<int>(), pol);
 }
\ No newline at end of file
@@ -0,0 +1,147 @@
+/**
+ * @file searchindex.cpp
+ * @brief Implementación de los índices de Eytzinger y árbol B estático
+ */
+
+#include "../.h/searchindex.h"
+#include "../.h/simd.h"
+
+#include <climits>
+#include <cstdint>
+
+// 0/ Desplazamiento (en enteros) que hace que datos + desplazamiento quede alineado a 64 bytes
+static int alinear64(const int* datos)
+{
+    std::uintptr_t dir = (std::uintptr_t)datos;
+    return (int)(((64 - dir % 64) % 64) / sizeof(int));
+}
+
+// 0/ ===================== Eytzinger =====================
+
+// 0/ Recorrido en orden del árbol implícito: el i-ésimo nodo visitado recibe a[i]
+static int llenarEytzinger(const int* a, int n, int* claves, int* posiciones, int i, int k)
+{
+    if (k <= n)
+    {
+        i = llenarEytzinger(a, n, claves, posiciones, i, 2 * k);
+        claves[k] = a[i];
+        posiciones[k] = i;
+        i++;
+        i = llenarEytzinger(a, n, claves, posiciones, i, 2 * k + 1);
+    }
+    return i;
+}
+
+IndiceEytzinger::IndiceEytzinger(const int* ordenado, int n)
+    : n_(n < 0 ? 0 : n), almacen_((size_t)n_ + 1 + 16), posiciones_((size_t)n_ + 1, -1)
+{
+    claves_ = almacen_.data() + alinear64(almacen_.data());
+    llenarEytzinger(ordenado, n_, claves_, posiciones_.data(), 0, 1);
+}
+
+int IndiceEytzinger::buscar(int valor) const
+{
+    unsigned int k = 1;
+
+    while (k <= (unsigned int)n_)
+    {
+        // 0/ Los 16 descendientes de k cuatro niveles más abajo están en claves_[16k .. 16k+15]:
+        // 0/ una línea alineada que llega antes de que se la necesite. Sólo es una pista: no se lee
+        precargarLectura(claves_ + 16 * (size_t)k);
+        k = 2 * k + (claves_[k] < valor);
+    }
+
+    // 0/ Se sale por la izquierda del nodo buscado: quitar los giros a la derecha finales
+    // 0/ (los unos bajos) y uno más. k = 0 significa que todas las claves son menores
+    k >>= primerBitEncendido(~k) + 1;
+
+    if (k == 0 || claves_[k] != valor) return -1;
+    return posiciones_[k];
+}
+
+// 0/ ===================== Árbol B estático =====================
+
+// 0/ Hijo i (0..B) del nodo k
+static inline int hijoArbolB(int k, int i)
+{
+    return k * (IndiceArbolB::B + 1) + i + 1;
+}
+
+// 0/ Recorrido en orden: hijo 0, clave 0, hijo 1, clave 1, ..., clave B-1, hijo B.
+// 0/ Las ranuras que sobran al final se rellenan con INT_MAX y posición n
+static void llenarArbolB(const int* a, int n, int nodos, int* claves, int* posiciones, int& t, int k)
+{
+    if (k >= nodos) return;
+
+    const int B = IndiceArbolB::B;
+    for (int i = 0; i < B; i++)
+    {
+        llenarArbolB(a, n, nodos, claves, posiciones, t, hijoArbolB(k, i));
+
+        if (t < n)
+        {
+            claves[k * B + i] = a[t];
+            posiciones[k * B + i] = t;
+            t++;
+        }
+        else
+        {
+            claves[k * B + i] = INT_MAX;
+            posiciones[k * B + i] = n;
+        }
+    }
+    llenarArbolB(a, n, nodos, claves, posiciones, t, hijoArbolB(k, B));
+}
+
+IndiceArbolB::IndiceArbolB(const int* ordenado, int n)
+    : n_(n < 0 ? 0 : n), nodos_((n_ + B - 1) / B),
+      almacen_((size_t)nodos_ * B + 16), posiciones_((size_t)nodos_ * B)
+{
+    claves_ = almacen_.data() + alinear64(almacen_.data());
+
+    int t = 0;
+    llenarArbolB(ordenado, n_, nodos_, claves_, posiciones_.data(), t, 0);
+}
+
+// 0/ Claves del nodo menores que valor. Dentro de un nodo las claves están ordenadas, así que
+// 0/ la máscara de "menor" es un bloque de unos desde el bit 0 y basta con buscar el primer cero
+static inline int menoresEnNodo(const int* nodo, int valor)
+{
+#if defined(SIMD_AVX2)
+    __m256i x = _mm256_set1_epi32(valor);
+    __m256i m0 = _mm256_cmpgt_epi32(x, _mm256_load_si256((const __m256i*)nodo));
+    __m256i m1 = _mm256_cmpgt_epi32(x, _mm256_load_si256((const __m256i*)(nodo + 8)));
+    unsigned int m = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(m0))
+                   | ((unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(m1)) << 8);
+    return primerBitEncendido(~m);
+#elif defined(SIMD_SSE2)
+    __m128i x = _mm_set1_epi32(valor);
+    __m128i m0 = _mm_cmpgt_epi32(x, _mm_load_si128((const __m128i*)nodo));
+    __m128i m1 = _mm_cmpgt_epi32(x, _mm_load_si128((const __m128i*)(nodo + 4)));
+    __m128i m2 = _mm_cmpgt_epi32(x, _mm_load_si128((const __m128i*)(nodo + 8)));
+    __m128i m3 = _mm_cmpgt_epi32(x, _mm_load_si128((const __m128i*)(nodo + 12)));
+    __m128i bytes = _mm_packs_epi16(_mm_packs_epi32(m0, m1), _mm_packs_epi32(m2, m3));
+    return primerBitEncendido(~(unsigned int)_mm_movemask_epi8(bytes));
+#else
+    int i = 0;
+    for (int j = 0; j < IndiceArbolB::B; j++) i += (nodo[j] < valor);
+    return i;
+#endif
+}
+
+int IndiceArbolB::buscar(int valor) const
+{
+    int k = 0;
+    int ranura = -1;
+
+    // 0/ La última clave >= valor vista al bajar es la cota inferior (la primera en orden)
+    while (k < nodos_)
+    {
+        int i = menoresEnNodo(claves_ + (size_t)k * B, valor);
+        if (i < B) ranura = k * B + i;
+        k = hijoArbolB(k, i);
+    }
+
+    if (ranura < 0 || posiciones_[ranura] == n_ || claves_[ranura] != valor) return -1;
+    return posiciones_[ranura];
+}
@@ -0,0 +1,303 @@
+/**
+ * @file searchsimd.cpp
+ * @brief Implementación de la búsqueda secuencial vectorizada (AVX2, SSE2 y escalar)
+ */
+
+#include "../.h/searchsimd.h"
+#include "../.h/simd.h"
+#include "../.h/threadpool.h"
+
+#include <atomic>
+
+#if defined(SIMD_AVX2) || defined(SIMD_SSE2)
+static bool simdActivo = true;
+#else
+static bool simdActivo = false;
+#endif
+
+void activarBusquedaSimd(bool activo)
+{
+    simdActivo = activo;
+}
+
+const char* nivelBusquedaSimd()
+{
+    if (!simdActivo) return "escalar";
+#if defined(SIMD_AVX2)
+    return "AVX2";
+#elif defined(SIMD_SSE2)
+    return "SSE2";
+#else
+    return "escalar";
+#endif
+}
+
+// 0/ ===================== Versiones escalares =====================
+
+static int buscarPrimeroEscalar(const int* a, int desde, int n, int valor)
+{
+    for (int i = desde; i < n; i++)
+        if (a[i] == valor) return i;
+    return -1;
+}
+
+static int contarEscalar(const int* a, int desde, int n, int valor)
+{
+    int total = 0;
+    for (int i = desde; i < n; i++) total += (a[i] == valor);
+    return total;
+}
+
+static int buscarTodosEscalar(const int* a, int desde, int n, int valor, int* salida, int escritas, int capacidad)
+{
+    for (int i = desde; i < n && escritas < capacidad; i++)
+        if (a[i] == valor) salida[escritas++] = i;
+    return escritas;
+}
+
+// 0/ ===================== AVX2: 8 enteros por vector =====================
+
+#if defined(SIMD_AVX2)
+
+static inline unsigned int mascaraIguales8(const int* p, __m256i v)
+{
+    __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)p), v);
+    return (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(eq));
+}
+
+static int buscarPrimeroAvx2(const int* a, int n, int valor)
+{
+    __m256i v = _mm256_set1_epi32(valor);
+    int i = 0;
+
+    // 0/ 4 vectores por vuelta: un solo salto para 32 elementos mientras no haya coincidencia
+    for (; i + 32 <= n; i += 32)
+    {
+        __m256i e0 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(a + i)), v);
+        __m256i e1 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(a + i + 8)), v);
+        __m256i e2 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(a + i + 16)), v);
+        __m256i e3 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(a + i + 24)), v);
+
+        __m256i alguno = _mm256_or_si256(_mm256_or_si256(e0, e1), _mm256_or_si256(e2, e3));
+        if (_mm256_testz_si256(alguno, alguno)) continue;
+
+        unsigned int m = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(e0))
+                       | ((unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(e1)) << 8)
+                       | ((unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(e2)) << 16)
+                       | ((unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(e3)) << 24);
+        return i + primerBitEncendido(m);
+    }
+
+    for (; i + 8 <= n; i += 8)
+    {
+        unsigned int m = mascaraIguales8(a + i, v);
+        if (m) return i + primerBitEncendido(m);
+    }
+
+    return buscarPrimeroEscalar(a, i, n, valor);
+}
+
+static int contarAvx2(const int* a, int n, int valor)
+{
+    __m256i v = _mm256_set1_epi32(valor);
+    __m256i acc0 = _mm256_setzero_si256();
+    __m256i acc1 = _mm256_setzero_si256();
+    int i = 0;
+
+    // 0/ cmpeq deja -1 en cada coincidencia: restarlo suma 1 por carril sin saltos
+    for (; i + 16 <= n; i += 16)
+    {
+        acc0 = _mm256_sub_epi32(acc0, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(a + i)), v));
+        acc1 = _mm256_sub_epi32(acc1, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(a + i + 8)), v));
+    }
+
+    alignas(32) int carriles[8];
+    _mm256_store_si256((__m256i*)carriles, _mm256_add_epi32(acc0, acc1));
+
+    int total = 0;
+    for (int k = 0; k < 8; k++) total += carriles[k];
+
+    return total + contarEscalar(a, i, n, valor);
+}
+
+static int buscarTodosAvx2(const int* a, int n, int valor, int* salida, int capacidad)
+{
+    __m256i v = _mm256_set1_epi32(valor);
+    int escritas = 0;
+    int i = 0;
+
+    for (; i + 8 <= n && escritas < capacidad; i += 8)
+    {
+        unsigned int m = mascaraIguales8(a + i, v);
+
+        while (m && escritas < capacidad)
+        {
+            salida[escritas++] = i + primerBitEncendido(m);
+            m &= m - 1;
+        }
+    }
+
+    return buscarTodosEscalar(a, i, n, valor, salida, escritas, capacidad);
+}
+
+#endif
+
+// 0/ ===================== SSE2: 4 enteros por vector =====================
+
+#if defined(SIMD_SSE2) && !defined(SIMD_AVX2)
+
+static inline unsigned int mascaraIguales4(const int* p, __m128i v)
+{
+    __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)p), v);
+    return (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(eq));
+}
+
+static int buscarPrimeroSse2(const int* a, int n, int valor)
+{
+    __m128i v = _mm_set1_epi32(valor);
+    int i = 0;
+
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i e0 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(a + i)), v);
+        __m128i e1 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(a + i + 4)), v);
+        __m128i e2 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(a + i + 8)), v);
+        __m128i e3 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(a + i + 12)), v);
+
+        // 0/ SSE2 no tiene ptest: se reúnen los 16 resultados en una máscara de bytes
+        __m128i alguno = _mm_packs_epi16(_mm_packs_epi32(e0, e1), _mm_packs_epi32(e2, e3));
+        unsigned int m = (unsigned int)_mm_movemask_epi8(alguno);
+        if (m) return i + primerBitEncendido(m);
+    }
+
+    for (; i + 4 <= n; i += 4)
+    {
+        unsigned int m = mascaraIguales4(a + i, v);
+        if (m) return i + primerBitEncendido(m);
+    }
+
+    return buscarPrimeroEscalar(a, i, n, valor);
+}
+
+static int contarSse2(const int* a, int n, int valor)
+{
+    __m128i v = _mm_set1_epi32(valor);
+    __m128i acc0 = _mm_setzero_si128();
+    __m128i acc1 = _mm_setzero_si128();
+    int i = 0;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        acc0 = _mm_sub_epi32(acc0, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(a + i)), v));
+        acc1 = _mm_sub_epi32(acc1, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(a + i + 4)), v));
+    }
+
+    alignas(16) int carriles[4];
+    _mm_store_si128((__m128i*)carriles, _mm_add_epi32(acc0, acc1));
+
+    return carriles[0] + carriles[1] + carriles[2] + carriles[3] + contarEscalar(a, i, n, valor);
+}
+
+static int buscarTodosSse2(const int* a, int n, int valor, int* salida, int capacidad)
+{
+    __m128i v = _mm_set1_epi32(valor);
+    int escritas = 0;
+    int i = 0;
+
+    for (; i + 4 <= n && escritas < capacidad; i += 4)
+    {
+        unsigned int m = mascaraIguales4(a + i, v);
+
+        while (m && escritas < capacidad)
+        {
+            salida[escritas++] = i + primerBitEncendido(m);
+            m &= m - 1;
+        }
+    }
+
+    return buscarTodosEscalar(a, i, n, valor, salida, escritas, capacidad);
+}
+
+#endif
+
+// 0/ ===================== Despacho =====================
+
+int buscarPrimeroSimd(const int* a, int n, int valor)
+{
+#if defined(SIMD_AVX2)
+    if (simdActivo) return buscarPrimeroAvx2(a, n, valor);
+#elif defined(SIMD_SSE2)
+    if (simdActivo) return buscarPrimeroSse2(a, n, valor);
+#endif
+    return buscarPrimeroEscalar(a, 0, n, valor);
+}
+
+int contarIgualesSimd(const int* a, int n, int valor)
+{
+#if defined(SIMD_AVX2)
+    if (simdActivo) return contarAvx2(a, n, valor);
+#elif defined(SIMD_SSE2)
+    if (simdActivo) return contarSse2(a, n, valor);
+#endif
+    return contarEscalar(a, 0, n, valor);
+}
+
+int buscarTodosSimd(const int* a, int n, int valor, int* salida, int capacidad)
+{
+    if (capacidad <= 0) return 0;
+
+#if defined(SIMD_AVX2)
+    if (simdActivo) return buscarTodosAvx2(a, n, valor, salida, capacidad);
+#elif defined(SIMD_SSE2)
+    if (simdActivo) return buscarTodosSse2(a, n, valor, salida, capacidad);
+#endif
+    return buscarTodosEscalar(a, 0, n, valor, salida, 0, capacidad);
+}
+
+// 0/ ===================== Búsqueda paralela =====================
+
+// 0/ 16K enteros (64 KB) por bloque: cabe en L2 y el contador atómico se toca poco
+static const int BLOQUE_PARALELO = 1 << 14;
+
+int buscarPrimeroParalelo(const int* a, int n, int valor, int hilos)
+{
+    if (hilos <= 0) hilos = hilosPorDefecto();
+
+    int bloques = (n + BLOQUE_PARALELO - 1) / BLOQUE_PARALELO;
+    if (hilos == 1 || bloques < 2) return buscarPrimeroSimd(a, n, valor);
+
+    PoolHilos& pool = poolCompartido(hilos);
+
+    // 0/ mejor = n significa "todavía no apareció"
+    std::atomic<int> siguiente(0);
+    std::atomic<int> mejor(n);
+
+    GrupoTareas grupo(pool);
+    for (int t = 0; t < hilos; t++)
+    {
+        grupo.lanzar([&]() {
+            while (true)
+            {
+                // 0/ Los bloques salen en orden creciente: si éste empieza después de la mejor
+                // 0/ posición, los que quedan también, y ninguno puede dar una más baja
+                int b = siguiente.fetch_add(1, std::memory_order_relaxed);
+                int inicio = b * BLOQUE_PARALELO;
+                if (b >= bloques || inicio >= mejor.load(std::memory_order_relaxed)) return;
+
+                int largo = n - inicio < BLOQUE_PARALELO ? n - inicio : BLOQUE_PARALELO;
+                int p = buscarPrimeroSimd(a + inicio, largo, valor);
+                if (p < 0) continue;
+
+                // 0/ Mínimo atómico: sólo se publica si mejora lo que ya encontró otro hilo
+                int pos = inicio + p;
+                int actual = mejor.load(std::memory_order_relaxed);
+                while (pos < actual && !mejor.compare_exchange_weak(actual, pos, std::memory_order_relaxed)) {}
+                return;
+            }
+            });
+    }
+    grupo.esperar();
+
+    int resultado = mejor.load();
+    return resultado == n ? -1 : resultado;
+}
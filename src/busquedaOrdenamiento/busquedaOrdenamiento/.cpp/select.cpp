@@ -0,0 +1,234 @@
+/**
+ * @file select.cpp
+ * @brief Implementación de introselect, ordenamiento parcial y top-k con montículo
+ */
+
+#include "../.h/select.h"
+#include "../.h/sort.h"
+
+#include <iostream>
+
+using std::cout;
+using std::vector;
+
+// 0/ Rangos de este tamaño o menos se resuelven con inserción
+static const int SELECCION_UMBRAL = 16;
+
+static void intercambiarSel(int arreglo[], int a, int b, int& intercambios)
+{
+    int temp = arreglo[a];
+    arreglo[a] = arreglo[b];
+    arreglo[b] = temp;
+    intercambios++;
+}
+
+static void insercionSel(int arreglo[], int izquierda, int derecha, int& comparaciones, int& intercambios)
+{
+    for (int i = izquierda + 1; i <= derecha; i++)
+    {
+        int clave = arreglo[i];
+        int j = i - 1;
+        while (j >= izquierda)
+        {
+            comparaciones++;
+            if (!(clave < arreglo[j])) break;
+            arreglo[j + 1] = arreglo[j];
+            intercambios++;
+            j--;
+        }
+        arreglo[j + 1] = clave;
+    }
+}
+
+// 0/ Mediana de medianas de grupos de 5: devuelve la posición de un pivote que deja
+// 0/ al menos ~30% del rango de cada lado
+static int pivoteMedianaDeMedianas(int arreglo[], int izquierda, int derecha, int& comparaciones, int& intercambios);
+
+static void seleccionInterna(int arreglo[], int izquierda, int derecha, int k,
+                             int& comparaciones, int& intercambios, bool verbose, int presupuesto)
+{
+    while (derecha - izquierda + 1 > SELECCION_UMBRAL)
+    {
+        int pivote;
+
+        if (presupuesto > 0)
+        {
+            // 0/ Mediana de tres: queda ordenada en izquierda, medio, derecha
+            int medio = izquierda + (derecha - izquierda) / 2;
+            comparaciones++;
+            if (arreglo[medio] < arreglo[izquierda]) intercambiarSel(arreglo, medio, izquierda, intercambios);
+            comparaciones++;
+            if (arreglo[derecha] < arreglo[medio])
+            {
+                intercambiarSel(arreglo, derecha, medio, intercambios);
+                comparaciones++;
+                if (arreglo[medio] < arreglo[izquierda]) intercambiarSel(arreglo, medio, izquierda, intercambios);
+            }
+            pivote = arreglo[medio];
+            presupuesto--;
+        }
+        else
+        {
+            // 0/ Demasiadas particiones malas: pivote con garantía lineal
+            pivote = arreglo[pivoteMedianaDeMedianas(arreglo, izquierda, derecha, comparaciones, intercambios)];
+        }
+
+        if (verbose) cout << "[Seleccion] rango " << izquierda << "-" << derecha << " pivote=" << pivote << " k=" << k << "\n";
+
+        // 0/ Partición de Hoare como la de quickSort (y contada igual): al cruzarse,
+        // 0/ [izquierda, j] <= pivote, (j, i) == pivote e [i, derecha] >= pivote
+        int i = izquierda;
+        int j = derecha;
+        while (i <= j)
+        {
+            while (arreglo[i] < pivote) { i++; comparaciones++; }
+            while (arreglo[j] > pivote) { j--; comparaciones++; }
+
+            if (i <= j)
+            {
+                intercambiarSel(arreglo, i, j, intercambios);
+                i++;
+                j--;
+            }
+        }
+
+        if (k <= j)      derecha = j;
+        else if (k >= i) izquierda = i;
+        else             return;
+    }
+
+    insercionSel(arreglo, izquierda, derecha, comparaciones, intercambios);
+}
+
+static int pivoteMedianaDeMedianas(int arreglo[], int izquierda, int derecha, int& comparaciones, int& intercambios)
+{
+    int n = derecha - izquierda + 1;
+    if (n <= 5)
+    {
+        insercionSel(arreglo, izquierda, derecha, comparaciones, intercambios);
+        return izquierda + n / 2;
+    }
+
+    // 0/ La mediana de cada grupo se junta al inicio del rango
+    int medianas = 0;
+    for (int g = izquierda; g <= derecha; g += 5)
+    {
+        int fin = g + 4 < derecha ? g + 4 : derecha;
+        insercionSel(arreglo, g, fin, comparaciones, intercambios);
+        intercambiarSel(arreglo, izquierda + medianas, g + (fin - g) / 2, intercambios);
+        medianas++;
+    }
+
+    int objetivo = izquierda + medianas / 2;
+    seleccionInterna(arreglo, izquierda, izquierda + medianas - 1, objetivo, comparaciones, intercambios, false, 0);
+    return objetivo;
+}
+
+int seleccionarK(int arreglo[], int n, int k, int& comparaciones, int& intercambios, bool verbose)
+{
+    if (n <= 0) return 0;
+    if (k < 0) k = 0;
+    if (k >= n) k = n - 1;
+
+    // 0/ Presupuesto de particiones con mediana de tres antes de pasar a mediana de medianas
+    int presupuesto = 0;
+    for (int m = n; m > 1; m >>= 1) presupuesto += 2;
+
+    seleccionInterna(arreglo, 0, n - 1, k, comparaciones, intercambios, verbose, presupuesto);
+    return arreglo[k];
+}
+
+void ordenarParcial(int arreglo[], int n, int k, int& comparaciones, int& intercambios, bool verbose)
+{
+    if (k <= 0 || n <= 1) return;
+    if (k > n) k = n;
+
+    // 0/ Separa los k menores y ordena sólo esos
+    if (k < n) seleccionarK(arreglo, n, k - 1, comparaciones, intercambios, verbose);
+    introSort(arreglo, 0, k - 1, comparaciones, intercambios, false);
+}
+
+TopK::TopK(int k) : k_(k < 0 ? 0 : k), comparaciones_(0)
+{
+    monticulo_.reserve(k_);
+}
+
+void TopK::hundir(int i)
+{
+    int n = (int)monticulo_.size();
+    int valor = monticulo_[i];
+
+    while (true)
+    {
+        int hijo = 2 * i + 1;
+        if (hijo >= n) break;
+
+        if (hijo + 1 < n)
+        {
+            comparaciones_++;
+            if (monticulo_[hijo + 1] < monticulo_[hijo]) hijo++;
+        }
+
+        comparaciones_++;
+        if (!(monticulo_[hijo] < valor)) break;
+
+        monticulo_[i] = monticulo_[hijo];
+        i = hijo;
+    }
+
+    monticulo_[i] = valor;
+}
+
+void TopK::agregar(int valor)
+{
+    if (k_ == 0) return;
+
+    if ((int)monticulo_.size() < k_)
+    {
+        // 0/ Subir el nuevo valor mientras sea menor que su padre
+        monticulo_.push_back(valor);
+        int i = (int)monticulo_.size() - 1;
+        while (i > 0)
+        {
+            int padre = (i - 1) / 2;
+            comparaciones_++;
+            if (!(valor < monticulo_[padre])) break;
+            monticulo_[i] = monticulo_[padre];
+            i = padre;
+        }
+        monticulo_[i] = valor;
+        return;
+    }
+
+    // 0/ Lleno: sólo entra si supera al menor conservado
+    comparaciones_++;
+    if (monticulo_[0] < valor)
+    {
+        monticulo_[0] = valor;
+        hundir(0);
+    }
+}
+
+vector<int> TopK::resultado() const
+{
+    vector<int> r = monticulo_;
+    int c = 0, t = 0;
+    introSort(r.data(), 0, (int)r.size() - 1, c, t);
+
+    for (int i = 0, j = (int)r.size() - 1; i < j; i++, j--)
+    {
+        int temp = r[i];
+        r[i] = r[j];
+        r[j] = temp;
+    }
+    return r;
+}
+
+vector<int> topK(const int* arreglo, int n, int k, int& comparaciones)
+{
+    TopK acumulador(k);
+    for (int i = 0; i < n; i++) acumulador.agregar(arreglo[i]);
+
+    comparaciones += acumulador.comparaciones();
+    return acumulador.resultado();
+}
@@ -0,0 +1,209 @@
+/**
+ * @file sortedlist.cpp
+ * @brief Implementación de la lista ordenada por hojas con árbol de Fenwick
+ */
+
+#include "../.h/sortedlist.h"
+
+#include <algorithm>
+#include <cstring>
+
+// 0/ Ocupación de las hojas al cargar en bloque: deja 1/4 libre para inserciones
+static const int LLENADO_CARGA = CAPACIDAD_HOJA * 3 / 4;
+
+// 0/ Dos hojas vecinas que juntas no pasan de esto se unen al borrar (evita hojas casi vacías)
+static const int UNIR_HOJAS = CAPACIDAD_HOJA / 2;
+
+ListaOrdenada::ListaOrdenada()
+    : n_(0)
+{
+}
+
+void ListaOrdenada::cargar(const int* ordenado, int n)
+{
+    hojas_.clear();
+    maximos_.clear();
+    n_ = n < 0 ? 0 : n;
+
+    for (int i = 0; i < n_; i += LLENADO_CARGA)
+    {
+        std::unique_ptr<Hoja> hoja(new Hoja);
+        hoja->cuenta = std::min(LLENADO_CARGA, n_ - i);
+        std::memcpy(hoja->valores, ordenado + i, hoja->cuenta * sizeof(int));
+
+        maximos_.push_back(hoja->valores[hoja->cuenta - 1]);
+        hojas_.push_back(std::move(hoja));
+    }
+
+    reconstruirFenwick();
+}
+
+// 0/ Primera hoja cuyo máximo es >= valor: todas las anteriores tienen sólo valores < valor, así
+// 0/ que ahí está la primera aparición (o la posición donde iría). Si no hay, hojas()
+int ListaOrdenada::hojaPara(int valor) const
+{
+    return (int)(std::lower_bound(maximos_.begin(), maximos_.end(), valor) - maximos_.begin());
+}
+
+// 0/ Suma de las cuentas de las hojas [0, h)
+int ListaOrdenada::anteriores(int h) const
+{
+    int suma = 0;
+    for (int i = h; i > 0; i -= i & -i) suma += fenwick_[i];
+    return suma;
+}
+
+void ListaOrdenada::sumarCuenta(int h, int delta)
+{
+    int total = hojas();
+    for (int i = h + 1; i <= total; i += i & -i) fenwick_[i] += delta;
+}
+
+// 0/ Construcción en O(hojas): cada nodo le pasa su suma al padre inmediato
+void ListaOrdenada::reconstruirFenwick()
+{
+    int total = hojas();
+    fenwick_.assign(total + 1, 0);
+
+    for (int i = 1; i <= total; i++)
+    {
+        fenwick_[i] += hojas_[i - 1]->cuenta;
+        int padre = i + (i & -i);
+        if (padre <= total) fenwick_[padre] += fenwick_[i];
+    }
+}
+
+void ListaOrdenada::insertar(int valor)
+{
+    if (hojas_.empty())
+    {
+        int uno[1] = { valor };
+        cargar(uno, 1);
+        return;
+    }
+
+    // 0/ Más allá del máximo global va al final de la última hoja
+    int h = std::min(hojaPara(valor), hojas() - 1);
+
+    if (hojas_[h]->cuenta == CAPACIDAD_HOJA)
+    {
+        // 0/ Hoja llena: la mitad alta pasa a una hoja nueva a su derecha
+        Hoja& llena = *hojas_[h];
+        std::unique_ptr<Hoja> nueva(new Hoja);
+        int mitad = CAPACIDAD_HOJA / 2;
+
+        nueva->cuenta = CAPACIDAD_HOJA - mitad;
+        std::memcpy(nueva->valores, llena.valores + mitad, nueva->cuenta * sizeof(int));
+        llena.cuenta = mitad;
+
+        maximos_[h] = llena.valores[mitad - 1];
+        maximos_.insert(maximos_.begin() + h + 1, nueva->valores[nueva->cuenta - 1]);
+        hojas_.insert(hojas_.begin() + h + 1, std::move(nueva));
+        reconstruirFenwick();
+
+        if (valor > maximos_[h]) h++;
+    }
+
+    // 0/ Después de los iguales: las inserciones repetidas quedan en orden de llegada
+    Hoja& hoja = *hojas_[h];
+    int p = (int)(std::upper_bound(hoja.valores, hoja.valores + hoja.cuenta, valor) - hoja.valores);
+    std::memmove(hoja.valores + p + 1, hoja.valores + p, (hoja.cuenta - p) * sizeof(int));
+    hoja.valores[p] = valor;
+    hoja.cuenta++;
+
+    maximos_[h] = hoja.valores[hoja.cuenta - 1];
+    sumarCuenta(h, 1);
+    n_++;
+}
+
+bool ListaOrdenada::borrar(int valor)
+{
+    int h = hojaPara(valor);
+    if (h == hojas()) return false;
+
+    Hoja& hoja = *hojas_[h];
+    int p = (int)(std::lower_bound(hoja.valores, hoja.valores + hoja.cuenta, valor) - hoja.valores);
+    if (hoja.valores[p] != valor) return false;
+
+    std::memmove(hoja.valores + p, hoja.valores + p + 1, (hoja.cuenta - p - 1) * sizeof(int));
+    hoja.cuenta--;
+    n_--;
+
+    if (hoja.cuenta == 0)
+    {
+        hojas_.erase(hojas_.begin() + h);
+        maximos_.erase(maximos_.begin() + h);
+        reconstruirFenwick();
+        return true;
+    }
+
+    maximos_[h] = hoja.valores[hoja.cuenta - 1];
+
+    if (h + 1 < hojas() && hoja.cuenta + hojas_[h + 1]->cuenta <= UNIR_HOJAS)
+    {
+        // 0/ La hoja siguiente se agrega al final de ésta y se quita
+        Hoja& siguiente = *hojas_[h + 1];
+        std::memcpy(hoja.valores + hoja.cuenta, siguiente.valores, siguiente.cuenta * sizeof(int));
+        hoja.cuenta += siguiente.cuenta;
+
+        maximos_[h] = maximos_[h + 1];
+        hojas_.erase(hojas_.begin() + h + 1);
+        maximos_.erase(maximos_.begin() + h + 1);
+        reconstruirFenwick();
+        return true;
+    }
+
+    sumarCuenta(h, -1);
+    return true;
+}
+
+int ListaOrdenada::buscar(int valor) const
+{
+    int h = hojaPara(valor);
+    if (h == hojas()) return -1;
+
+    // 0/ maximos_[h] >= valor: la cota inferior está dentro de la hoja
+    const Hoja& hoja = *hojas_[h];
+    int p = (int)(std::lower_bound(hoja.valores, hoja.valores + hoja.cuenta, valor) - hoja.valores);
+    return hoja.valores[p] == valor ? anteriores(h) + p : -1;
+}
+
+int ListaOrdenada::rango(int valor) const
+{
+    int h = hojaPara(valor);
+    if (h == hojas()) return n_;
+
+    const Hoja& hoja = *hojas_[h];
+    int p = (int)(std::lower_bound(hoja.valores, hoja.valores + hoja.cuenta, valor) - hoja.valores);
+    return anteriores(h) + p;
+}
+
+int ListaOrdenada::seleccionar(int k) const
+{
+    // 0/ Descenso por el árbol de Fenwick: se avanza por potencias de 2 mientras las hojas
+    // 0/ salteadas sumen <= k; al final pos es la hoja y k la posición dentro de ella
+    int total = hojas();
+    int paso = 1;
+    while (paso * 2 <= total) paso *= 2;
+
+    int pos = 0;
+    for (; paso > 0; paso /= 2)
+    {
+        if (pos + paso <= total && fenwick_[pos + paso] <= k)
+        {
+            pos += paso;
+            k -= fenwick_[pos];
+        }
+    }
+
+    return hojas_[pos]->valores[k];
+}
+
+void ListaOrdenada::copiarA(int* salida) const
+{
+    for (const std::unique_ptr<Hoja>& hoja : hojas_)
+    {
+        std::memcpy(salida, hoja->valores, hoja->cuenta * sizeof(int));
+        salida += hoja->cuenta;
+    }
+}
@@ -0,0 +1,185 @@
+/**
+ * @file sortnet.cpp
+ * @brief Implementación de las redes de ordenamiento bitónicas (AVX2 y escalar)
+ */
+
+#include "../.h/sortnet.h"
+#include "../.h/simd.h"
+
+#include <algorithm>
+#include <climits>
+
+// 0/ La red escalar hace más comparaciones que una inserción sobre el mismo rango y no gana
+// 0/ tiempo; por eso los kernels sólo arrancan activos cuando hay AVX2
+#if defined(SIMD_AVX2)
+static bool kernelsActivos = true;
+#else
+static bool kernelsActivos = false;
+#endif
+
+void activarKernelsRed(bool activo)
+{
+    kernelsActivos = activo;
+}
+
+bool kernelsRedActivos()
+{
+    return kernelsActivos;
+}
+
+#if defined(SIMD_AVX2)
+
+// 0/ Un paso de la red dentro de un registro: cada carril se compara con el carril pareja
+// 0/ y se queda con el mínimo o con el máximo según el bit de MASCARA (1 = máximo)
+template <int MASCARA>
+static inline __m256i pasoRed(__m256i v, __m256i pareja)
+{
+    __m256i p = _mm256_permutevar8x32_epi32(v, pareja);
+    __m256i mn = _mm256_min_epi32(v, p);
+    __m256i mx = _mm256_max_epi32(v, p);
+    return _mm256_blend_epi32(mn, mx, MASCARA);
+}
+
+static inline __m256i pareja1() { return _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6); }
+static inline __m256i pareja2() { return _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5); }
+static inline __m256i pareja4() { return _mm256_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3); }
+
+static inline __m256i invertir(__m256i v)
+{
+    return _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+}
+
+// 0/ Red bitónica completa de 8 (6 pasos)
+static inline __m256i ordenar8(__m256i v)
+{
+    v = pasoRed<0x66>(v, pareja1());
+    v = pasoRed<0x3c>(v, pareja2());
+    v = pasoRed<0x5a>(v, pareja1());
+    v = pasoRed<0xf0>(v, pareja4());
+    v = pasoRed<0xcc>(v, pareja2());
+    v = pasoRed<0xaa>(v, pareja1());
+    return v;
+}
+
+// 0/ Mezcla bitónica de un registro (la entrada es una secuencia bitónica)
+static inline __m256i mezclar8(__m256i v)
+{
+    v = pasoRed<0xf0>(v, pareja4());
+    v = pasoRed<0xcc>(v, pareja2());
+    v = pasoRed<0xaa>(v, pareja1());
+    return v;
+}
+
+// 0/ Dos registros ordenados -> 16 ordenados (a queda con los 8 menores)
+static inline void mezclar16(__m256i& a, __m256i& b)
+{
+    b = invertir(b);
+    __m256i mn = _mm256_min_epi32(a, b);
+    __m256i mx = _mm256_max_epi32(a, b);
+    a = mezclar8(mn);
+    b = mezclar8(mx);
+}
+
+// 0/ Mezcla bitónica de 16 repartidos en dos registros
+static inline void mezclarBitonica16(__m256i& a, __m256i& b)
+{
+    __m256i mn = _mm256_min_epi32(a, b);
+    __m256i mx = _mm256_max_epi32(a, b);
+    a = mezclar8(mn);
+    b = mezclar8(mx);
+}
+
+void ordenarRed8(int* a)
+{
+    __m256i v = _mm256_loadu_si256((const __m256i*)a);
+    _mm256_storeu_si256((__m256i*)a, ordenar8(v));
+}
+
+void ordenarRed16(int* a)
+{
+    __m256i v0 = ordenar8(_mm256_loadu_si256((const __m256i*)a));
+    __m256i v1 = ordenar8(_mm256_loadu_si256((const __m256i*)(a + 8)));
+    mezclar16(v0, v1);
+    _mm256_storeu_si256((__m256i*)a, v0);
+    _mm256_storeu_si256((__m256i*)(a + 8), v1);
+}
+
+void ordenarRed32(int* a)
+{
+    __m256i v0 = ordenar8(_mm256_loadu_si256((const __m256i*)a));
+    __m256i v1 = ordenar8(_mm256_loadu_si256((const __m256i*)(a + 8)));
+    __m256i v2 = ordenar8(_mm256_loadu_si256((const __m256i*)(a + 16)));
+    __m256i v3 = ordenar8(_mm256_loadu_si256((const __m256i*)(a + 24)));
+    mezclar16(v0, v1);
+    mezclar16(v2, v3);
+
+    // 0/ La segunda mitad invertida (v3', v2') forma con (v0, v1) una secuencia bitónica de 32
+    __m256i r2 = invertir(v3);
+    __m256i r3 = invertir(v2);
+    __m256i l0 = _mm256_min_epi32(v0, r2);
+    __m256i h0 = _mm256_max_epi32(v0, r2);
+    __m256i l1 = _mm256_min_epi32(v1, r3);
+    __m256i h1 = _mm256_max_epi32(v1, r3);
+    mezclarBitonica16(l0, l1);
+    mezclarBitonica16(h0, h1);
+
+    _mm256_storeu_si256((__m256i*)a, l0);
+    _mm256_storeu_si256((__m256i*)(a + 8), l1);
+    _mm256_storeu_si256((__m256i*)(a + 16), h0);
+    _mm256_storeu_si256((__m256i*)(a + 24), h1);
+}
+
+#else
+
+// 0/ Misma red bitónica en escalar; min/max sin saltos (el compilador los vuelve cmov o pminsd)
+template <int N>
+static void redBitonica(int* a)
+{
+    for (int k = 2; k <= N; k *= 2)
+    {
+        for (int j = k / 2; j >= 1; j /= 2)
+        {
+            // 0/ Pares (i, i + j) dentro de cada grupo de 2j; la dirección depende del bloque de tamaño k
+            for (int g = 0; g < N; g += 2 * j)
+            {
+                bool ascendente = (g & k) == 0;
+
+                for (int i = g; i < g + j; i++)
+                {
+                    int x = a[i];
+                    int y = a[i + j];
+                    int mn = std::min(x, y);
+                    int mx = std::max(x, y);
+                    a[i] = ascendente ? mn : mx;
+                    a[i + j] = ascendente ? mx : mn;
+                }
+            }
+        }
+    }
+}
+
+void ordenarRed8(int* a)  { redBitonica<8>(a); }
+void ordenarRed16(int* a) { redBitonica<16>(a); }
+void ordenarRed32(int* a) { redBitonica<32>(a); }
+
+#endif
+
+int ordenarRedPequena(int* a, int n)
+{
+    if (n < 2) return 0;
+
+    // 0/ Relleno con INT_MAX: quedan al final y no se copian de vuelta
+    int bloque[RED_MAXIMO];
+    int tam = n <= 8 ? 8 : (n <= 16 ? 16 : 32);
+
+    for (int i = 0; i < n; i++) bloque[i] = a[i];
+    for (int i = n; i < tam; i++) bloque[i] = INT_MAX;
+
+    int comparadores;
+    if (tam == 8)       { ordenarRed8(bloque);  comparadores = 24; }
+    else if (tam == 16) { ordenarRed16(bloque); comparadores = 80; }
+    else                { ordenarRed32(bloque); comparadores = 240; }
+
+    for (int i = 0; i < n; i++) a[i] = bloque[i];
+    return comparadores;
+}
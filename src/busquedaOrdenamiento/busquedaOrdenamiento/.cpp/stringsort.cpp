@@ -0,0 +1,175 @@
+/**
+ * @file stringsort.cpp
+ * @brief Implementación del quicksort multiclave con prefijos de 8 bytes en caché
+ */
+
+#include "../.h/stringsort.h"
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+using std::cout;
+using std::string;
+using std::vector;
+
+// 0/ Grupos de este tamaño o menos se terminan con inserción
+static const int CADENAS_UMBRAL_INSERCION = 16;
+// 0/ Bytes que caben en el prefijo cacheado
+static const std::size_t BYTES_PREFIJO = 8;
+
+struct EntradaCadena
+{
+    std::uint64_t prefijo;   // 0/ bytes [profundidad, profundidad + 8) en big-endian, con ceros de relleno
+    const string* s;
+};
+
+// 0/ Empaqueta los 8 bytes desde profundidad; lo que falta de la cadena queda en cero
+static inline std::uint64_t cargarPrefijo(const string& s, std::size_t profundidad)
+{
+    std::uint64_t v = 0;
+    std::size_t largo = s.size() > profundidad ? s.size() - profundidad : 0;
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(s.data()) + (largo > 0 ? profundidad : 0);
+
+    for (std::size_t k = 0; k < BYTES_PREFIJO; k++)
+        v = (v << 8) | (k < largo ? p[k] : 0u);
+    return v;
+}
+
+// 0/ Compara a partir de profundidad (los bytes anteriores ya se sabe que son iguales)
+static inline bool menorDesde(const string& a, const string& b, std::size_t profundidad)
+{
+    std::size_t la = a.size() > profundidad ? a.size() - profundidad : 0;
+    std::size_t lb = b.size() > profundidad ? b.size() - profundidad : 0;
+    std::size_t m = la < lb ? la : lb;
+
+    int c = m > 0 ? std::memcmp(a.data() + profundidad, b.data() + profundidad, m) : 0;
+    return c != 0 ? c < 0 : la < lb;
+}
+
+static inline void intercambiarEntradas(EntradaCadena* a, int i, int j)
+{
+    EntradaCadena t = a[i];
+    a[i] = a[j];
+    a[j] = t;
+}
+
+// 0/ Inserción: primero por prefijo cacheado y, si empata, por la cadena desde profundidad
+// 0/ (no desde profundidad + 8: un prefijo igual no distingue "a" de "a\0")
+static void insercionCadenas(EntradaCadena* a, int n, std::size_t profundidad)
+{
+    for (int i = 1; i < n; i++)
+    {
+        EntradaCadena v = a[i];
+        int j = i - 1;
+        while (j >= 0)
+        {
+            bool menor = v.prefijo != a[j].prefijo
+                ? v.prefijo < a[j].prefijo
+                : menorDesde(*v.s, *a[j].s, profundidad);
+            if (!menor) break;
+            a[j + 1] = a[j];
+            j--;
+        }
+        a[j + 1] = v;
+    }
+}
+
+static std::uint64_t medianaDeTres(std::uint64_t x, std::uint64_t y, std::uint64_t z)
+{
+    if (x < y)
+    {
+        if (y < z) return y;
+        return x < z ? z : x;
+    }
+    if (x < z) return x;
+    return y < z ? z : y;
+}
+
+static void quicksortMulticlave(EntradaCadena* a, int n, std::size_t profundidad, bool verbose)
+{
+    while (n > CADENAS_UMBRAL_INSERCION)
+    {
+        std::uint64_t pivote = medianaDeTres(a[0].prefijo, a[n / 2].prefijo, a[n - 1].prefijo);
+
+        // 0/ Partición de tres vías (Dijkstra): [0, lt) < pivote, [lt, i) == pivote, (gt, n) > pivote
+        int lt = 0, i = 0, gt = n - 1;
+        while (i <= gt)
+        {
+            std::uint64_t p = a[i].prefijo;
+            if (p < pivote)      intercambiarEntradas(a, lt++, i++);
+            else if (p > pivote) intercambiarEntradas(a, i, gt--);
+            else                 i++;
+        }
+
+        // 0/ Menores y mayores siguen en la misma profundidad
+        quicksortMulticlave(a, lt, profundidad, verbose);
+        quicksortMulticlave(a + gt + 1, n - gt - 1, profundidad, verbose);
+
+        // 0/ Iguales: las que terminan dentro de estos 8 bytes ya están en su lugar (van
+        // 0/ primero, ordenadas por largo por si tienen '\0' al final); el resto avanza
+        EntradaCadena* igual = a + lt;
+        int nIgual = gt + 1 - lt;
+        std::size_t limite = profundidad + BYTES_PREFIJO;
+
+        int terminadas = 0;
+        for (int k = 0; k < nIgual; k++)
+            if (igual[k].s->size() <= limite) intercambiarEntradas(igual, terminadas++, k);
+
+        for (int k = 1; k < terminadas; k++)
+        {
+            EntradaCadena v = igual[k];
+            int j = k - 1;
+            while (j >= 0 && igual[j].s->size() > v.s->size())
+            {
+                igual[j + 1] = igual[j];
+                j--;
+            }
+            igual[j + 1] = v;
+        }
+
+        a = igual + terminadas;
+        n = nIgual - terminadas;
+        profundidad = limite;
+
+        if (verbose && n > 1)
+            cout << "[Cadenas] " << n << " cadenas comparten prefijo, profundidad " << profundidad << "\n";
+
+        for (int k = 0; k < n; k++) a[k].prefijo = cargarPrefijo(*a[k].s, profundidad);
+    }
+
+    insercionCadenas(a, n, profundidad);
+}
+
+// 0/ Entradas ordenadas para el vector completo
+static vector<EntradaCadena> ordenarEntradas(const vector<string>& cadenas, bool verbose)
+{
+    int n = (int)cadenas.size();
+    vector<EntradaCadena> e(n);
+    for (int i = 0; i < n; i++) e[i] = { cargarPrefijo(cadenas[i], 0), &cadenas[i] };
+
+    quicksortMulticlave(e.data(), n, 0, verbose);
+    return e;
+}
+
+void ordenarCadenas(vector<string>& cadenas, bool verbose)
+{
+    if (cadenas.size() < 2) return;
+
+    vector<EntradaCadena> e = ordenarEntradas(cadenas, verbose);
+
+    // 0/ Las cadenas se mueven (sólo punteros internos) al orden final
+    vector<string> resultado;
+    resultado.reserve(cadenas.size());
+    for (const EntradaCadena& x : e) resultado.push_back(std::move(cadenas[x.s - cadenas.data()]));
+    cadenas.swap(resultado);
+}
+
+vector<int> argsortCadenas(const vector<string>& cadenas)
+{
+    vector<EntradaCadena> e = ordenarEntradas(cadenas, false);
+
+    vector<int> permutacion(e.size());
+    for (std::size_t i = 0; i < e.size(); i++) permutacion[i] = (int)(e[i].s - cadenas.data());
+    return permutacion;
+}
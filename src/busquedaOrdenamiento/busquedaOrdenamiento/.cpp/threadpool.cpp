@@ -0,0 +1,158 @@
+/**
+ * @file threadpool.cpp
+ * @brief Implementación del pool de hilos con robo de trabajo
+ */
+
+#include "../.h/threadpool.h"
+
+#include <map>
+#include <mutex>
+
+// 0/ Identidad del hilo actual: a qué pool pertenece y qué cola es la suya
+static thread_local PoolHilos* poolActual = nullptr;
+static thread_local int indiceActual = -1;
+
+PoolHilos::PoolHilos(int hilos)
+    : hilos_(hilos < 1 ? 1 : hilos), detener_(false), pendientes_(0)
+{
+    int trabajadores = hilos_ - 1;
+
+    // 0/ Una cola por trabajador y una extra (la última) para tareas de hilos externos
+    for (int i = 0; i <= trabajadores; i++)
+        colas_.push_back(std::unique_ptr<Cola>(new Cola()));
+
+    for (int i = 0; i < trabajadores; i++)
+        trabajadores_.emplace_back([this, i]() { bucleTrabajador(i); });
+}
+
+PoolHilos::~PoolHilos()
+{
+    {
+        std::lock_guard<std::mutex> lk(mSueno_);
+        detener_ = true;
+    }
+    cvSueno_.notify_all();
+
+    for (std::thread& t : trabajadores_) t.join();
+}
+
+void PoolHilos::encolar(std::function<void()> tarea)
+{
+    int indice = (poolActual == this && indiceActual >= 0) ? indiceActual : (int)colas_.size() - 1;
+
+    {
+        std::lock_guard<std::mutex> lk(colas_[indice]->m);
+        colas_[indice]->tareas.push_back(std::move(tarea));
+    }
+    pendientes_++;
+
+    // 0/ Tomar el mutex antes de notificar evita perder el aviso si un trabajador se está durmiendo
+    {
+        std::lock_guard<std::mutex> lk(mSueno_);
+    }
+    cvSueno_.notify_one();
+}
+
+bool PoolHilos::tomarTarea(int indice, std::function<void()>& tarea)
+{
+    int total = (int)colas_.size();
+    int inyeccion = total - 1;
+
+    // 0/ Cola propia por el final (LIFO): la tarea más reciente es la de datos más calientes
+    int propia = indice >= 0 ? indice : inyeccion;
+    {
+        std::lock_guard<std::mutex> lk(colas_[propia]->m);
+        if (!colas_[propia]->tareas.empty())
+        {
+            tarea = std::move(colas_[propia]->tareas.back());
+            colas_[propia]->tareas.pop_back();
+            pendientes_--;
+            return true;
+        }
+    }
+
+    // 0/ Robo por el inicio (FIFO): las tareas más viejas suelen ser las más grandes
+    for (int k = 1; k < total; k++)
+    {
+        int victima = (propia + k) % total;
+        std::lock_guard<std::mutex> lk(colas_[victima]->m);
+        if (!colas_[victima]->tareas.empty())
+        {
+            tarea = std::move(colas_[victima]->tareas.front());
+            colas_[victima]->tareas.pop_front();
+            pendientes_--;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool PoolHilos::ejecutarUnaPendiente()
+{
+    int indice = (poolActual == this) ? indiceActual : -1;
+
+    std::function<void()> tarea;
+    if (!tomarTarea(indice, tarea)) return false;
+
+    tarea();
+    return true;
+}
+
+void PoolHilos::bucleTrabajador(int indice)
+{
+    poolActual = this;
+    indiceActual = indice;
+
+    while (true)
+    {
+        std::function<void()> tarea;
+        if (tomarTarea(indice, tarea))
+        {
+            tarea();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lk(mSueno_);
+        cvSueno_.wait(lk, [this]() { return detener_ || pendientes_ > 0; });
+        if (detener_ && pendientes_ == 0) return;
+    }
+}
+
+void GrupoTareas::lanzar(std::function<void()> tarea)
+{
+    activas_++;
+    pool_.encolar([this, tarea]() {
+        tarea();
+        activas_--;
+        });
+}
+
+void GrupoTareas::esperar()
+{
+    // 0/ En vez de bloquearse, el hilo que espera trabaja en lo que haya pendiente
+    while (activas_.load() > 0)
+    {
+        if (!pool_.ejecutarUnaPendiente()) std::this_thread::yield();
+    }
+}
+
+int hilosPorDefecto()
+{
+    unsigned int hw = std::thread::hardware_concurrency();
+    return hw == 0 ? 1 : (int)hw;
+}
+
+PoolHilos& poolCompartido(int hilos)
+{
+    // 0/ Un pool por cantidad de hilos: alternar entre 1, 2, 4, 8 hilos no vuelve a crear hilos
+    static std::map<int, std::unique_ptr<PoolHilos>> pools;
+    static std::mutex m;
+
+    if (hilos <= 0) hilos = hilosPorDefecto();
+
+    std::lock_guard<std::mutex> lk(m);
+    std::unique_ptr<PoolHilos>& pool = pools[hilos];
+    if (!pool) pool.reset(new PoolHilos(hilos));
+    return *pool;
+}
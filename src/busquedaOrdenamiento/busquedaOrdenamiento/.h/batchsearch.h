@@ -0,0 +1,49 @@
+#pragma once
+/**
+ * @file batchsearch.h
+ * @brief Búsqueda de muchos valores a la vez sobre el mismo arreglo ordenado
+ * @details Una búsqueda binaria sola espera una falla de caché por nivel sin poder hacer nada
+ *          más. Con un lote se pueden avanzar varias búsquedas en paralelo:
+ *          - Intercalado: grupos de 16 consultas bajan juntas un nivel por vuelta (todas tienen
+ *            el mismo largo de rango), sin saltos, precargando la próxima posición de cada una;
+ *            las fallas de caché de las 16 se superponen.
+ *          - Ordenar y recorrer: con un arreglo que no entra en caché y un lote grande respecto
+ *            de él conviene ordenar las consultas (radix, O(q)) y responderlas en un solo
+ *            recorrido secuencial del arreglo. Si el arreglo entra en caché el intercalado gana
+ *            siempre: ordenar las consultas cuesta más que las fallas que se ahorran.
+ */
+
+#ifndef BATCHSEARCH_H
+#define BATCHSEARCH_H
+
+/**
+ * @enum ModoLote
+ * @brief Estrategia para responder el lote
+ */
+enum class ModoLote {
+    Automatico,        ///< Ordenar y recorrer si n >= LOTE_ARREGLO_GRANDE y q >= n / UMBRAL_LOTE_ORDENAR
+    Intercalado,       ///< Búsquedas binarias sin saltos intercaladas de a 16, con precarga
+    OrdenarYRecorrer   ///< Ordenar las consultas y mezclarlas con el arreglo
+};
+
+/// Arreglos de este tamaño o más (4 MB) ya no entran en caché y cada búsqueda paga fallas reales
+const int LOTE_ARREGLO_GRANDE = 1 << 20;
+
+/// Con q >= n / UMBRAL_LOTE_ORDENAR el recorrido secuencial le gana a q búsquedas de O(log n) fallas
+const int UMBRAL_LOTE_ORDENAR = 16;
+
+/**
+ * @brief Busca cada consulta en el arreglo ordenado
+ * @param ordenado Arreglo ordenado ascendente (no se modifica)
+ * @param n Tamaño del arreglo
+ * @param consultas Valores a buscar (en cualquier orden, con repetidos)
+ * @param q Cantidad de consultas
+ * @param posiciones Salida: posiciones[i] = primera aparición de consultas[i] en ordenado, o -1
+ * @param modo Estrategia (por defecto se elige según q y n)
+ * @complexity Intercalado: O(q log n); Ordenar y recorrer: O(q + n)
+ * @spacecomplexity Intercalado: O(1); Ordenar y recorrer: O(q)
+ */
+void buscarLote(const int* ordenado, int n, const int* consultas, int q, int* posiciones,
+                ModoLote modo = ModoLote::Automatico);
+
+#endif // BATCHSEARCH_H
@@ -0,0 +1,144 @@
+#pragma once
+/**
+ * @file bloom.h
+ * @brief Filtro de Bloom por bloques para descartar búsquedas que no van a encontrar nada
+ * @details Cada valor elige un bloque de 512 bits (una línea de caché de 64 bytes) y enciende
+ *          k bits dentro de él, así que una consulta lee una sola línea sin importar k. Si
+ *          algún bit está apagado el valor seguro no está y la búsqueda devuelve -1 sin
+ *          recorrer el arreglo; si están todos, puede estar (falso positivo con probabilidad
+ *          ~ tasa pedida) y se hace la búsqueda normal.
+ */
+
+#ifndef BLOOM_H
+#define BLOOM_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class FiltroBloom
+ * @brief Filtro de pertenencia con tasa de falsos positivos configurable y contadores
+ */
+class FiltroBloom
+{
+public:
+    /**
+     * @brief Construye el filtro con los valores del arreglo
+     * @param a Arreglo en cualquier orden (no se guarda: si cambia, hay que reconstruir)
+     * @param n Tamaño del arreglo
+     * @param tasaFalsosPositivos Probabilidad buscada de que un valor ausente pase el filtro (0..1)
+     * @complexity O(n·k)
+     * @spacecomplexity O(n·log(1/tasa)) bits - ~1.44·log2(1/tasa) bits por elemento más el margen
+     *                  que necesita la versión por bloques (k y bits se eligen con el modelo
+     *                  de carga por bloque)
+     */
+    FiltroBloom(const int* a, int n, double tasaFalsosPositivos = 0.01);
+
+    /**
+     * @brief Vuelve a llenar el filtro con un arreglo nuevo (misma tasa)
+     * @param a Arreglo en cualquier orden
+     * @param n Tamaño del arreglo
+     * @complexity O(n·k)
+     */
+    void reconstruir(const int* a, int n);
+
+    /**
+     * @brief Indica si valor puede estar en el arreglo (false = seguro que no está)
+     * @param valor Valor consultado
+     * @return bool false si es un descarte seguro
+     * @complexity O(k) sobre una sola línea de caché
+     */
+    bool puedeContener(int valor) const;
+
+    /**
+     * @brief Bits de filtro por elemento indexado
+     * @return double Memoria del filtro en bits dividida por n (0 si está vacío)
+     * @complexity O(1)
+     */
+    double bitsPorElemento() const;
+
+    /**
+     * @brief Memoria del filtro
+     * @return long long Bytes
+     * @complexity O(1)
+     */
+    long long bytes() const { return (long long)bloques_.size() * sizeof(std::uint64_t); }
+
+    /**
+     * @brief Bits encendidos por valor (k)
+     * @return int k
+     * @complexity O(1)
+     */
+    int funcionesHash() const { return k_; }
+
+    /**
+     * @brief Tasa de falsos positivos con la que se dimensionó
+     * @return double Tasa pedida al construir (0..1)
+     * @complexity O(1)
+     */
+    double tasaObjetivo() const { return tasa_; }
+
+    /**
+     * @brief Consultas hechas a puedeContener desde el último reinicio
+     * @return long long Cantidad de consultas
+     * @complexity O(1)
+     */
+    long long consultas() const { return consultas_; }
+
+    /**
+     * @brief Consultas descartadas (respuesta "seguro que no está")
+     * @return long long Cantidad de descartes
+     * @complexity O(1)
+     */
+    long long descartes() const { return descartes_; }
+
+    /**
+     * @brief Consultas que pasaron el filtro (presentes o falsos positivos)
+     * @return long long consultas() - descartes()
+     * @complexity O(1)
+     */
+    long long aceptadas() const { return consultas_ - descartes_; }
+
+    /**
+     * @brief Pone los contadores de consultas y descartes en cero
+     * @complexity O(1)
+     */
+    void reiniciarContadores() { consultas_ = 0; descartes_ = 0; }
+
+private:
+    static const int PALABRAS_POR_BLOQUE = 8;   ///< 8 x 64 bits = 512 bits = 64 bytes
+
+    std::vector<std::uint64_t> bloques_;
+    std::uint64_t numBloques_;
+    int k_;
+    double bitsPorElementoObjetivo_;
+    int n_;
+    double tasa_;
+
+    mutable long long consultas_;
+    mutable long long descartes_;
+};
+
+/**
+ * @brief busquedaSecuencial con descarte previo por el filtro
+ * @param filtro Filtro construido sobre el mismo arreglo
+ * @param arr Arreglo (no se modifica)
+ * @param n Tamaño del arreglo
+ * @param valor Valor buscado
+ * @return int Igual que busquedaSecuencial
+ * @complexity O(1) si el filtro descarta, O(n) si no
+ */
+int busquedaSecuencialFiltrada(const FiltroBloom& filtro, const int* arr, int n, int valor);
+
+/**
+ * @brief busquedaBinaria con descarte previo por el filtro
+ * @param filtro Filtro construido sobre el mismo arreglo
+ * @param ordenado Arreglo ordenado (no se modifica)
+ * @param n Tamaño del arreglo
+ * @param valor Valor buscado
+ * @return int Igual que busquedaBinaria
+ * @complexity O(1) si el filtro descarta, O(log n) si no
+ */
+int busquedaBinariaFiltrada(const FiltroBloom& filtro, const int* ordenado, int n, int valor);
+
+#endif // BLOOM_H
@@ -0,0 +1,93 @@
+#pragma once
+/**
+ * @file dataset.h
+ * @brief Arreglo de trabajo del menú con seguimiento de orden y copia ordenada en caché
+ * @details La búsqueda binaria necesita los datos ordenados. En vez de reordenar antes de cada
+ *          consulta, el conjunto recuerda si sus datos ya están ordenados (se verifica una vez,
+ *          en O(n)) y, si no, guarda una copia ordenada con ordenarAuto que se reutiliza hasta
+ *          que los datos cambian. Todo cambio pasa por reemplazar o modificar, que invalidan
+ *          ambas cosas.
+ */
+
+#ifndef DATASET_H
+#define DATASET_H
+
+#include <vector>
+
+/**
+ * @class ConjuntoDatos
+ * @brief Vector de enteros que sabe si está ordenado y cachea su versión ordenada
+ */
+class ConjuntoDatos
+{
+public:
+    /**
+     * @brief Conjunto vacío
+     * @complexity O(1)
+     */
+    ConjuntoDatos();
+
+    /**
+     * @brief Reemplaza los datos (p. ej. al regenerar) e invalida el estado de orden y la caché
+     * @param valores Datos nuevos (se mueven al conjunto)
+     * @complexity O(1)
+     */
+    void reemplazar(std::vector<int> valores);
+
+    /**
+     * @brief Acceso de escritura a los datos; invalida el estado de orden y la caché
+     * @return std::vector<int>& Datos (no cambiar su tamaño fuera de reemplazar)
+     * @complexity O(1) - la copia en caché se libera
+     */
+    std::vector<int>& modificar();
+
+    /**
+     * @brief Datos en su orden actual (sin ordenar)
+     * @return const std::vector<int>& Datos tal como se generaron o modificaron
+     * @complexity O(1)
+     */
+    const std::vector<int>& datos() const { return datos_; }
+
+    /**
+     * @brief Cantidad de elementos
+     * @return int Tamaño de los datos
+     * @complexity O(1)
+     */
+    int tamano() const { return (int)datos_.size(); }
+
+    /**
+     * @brief Indica si los datos ya están en orden ascendente
+     * @return bool true si están ordenados
+     * @complexity O(n) la primera vez después de un cambio, O(1) después
+     */
+    bool estaOrdenado() const;
+
+    /**
+     * @brief Versión ordenada de los datos, lista para busquedaBinaria
+     * @return const std::vector<int>& Los propios datos si ya están ordenados; si no, la copia
+     *         en caché (se construye con ordenarAuto la primera vez)
+     * @complexity O(n log n) la primera vez después de un cambio (O(n) si ya estaban
+     *             ordenados), O(1) después
+     * @spacecomplexity O(n) sólo si los datos no están ordenados
+     */
+    const std::vector<int>& ordenado();
+
+    /**
+     * @brief Indica si hay una copia ordenada guardada
+     * @return bool true si ordenado() devolverá la caché sin ordenar
+     * @complexity O(1)
+     */
+    bool hayCopiaOrdenada() const { return copiaValida_; }
+
+private:
+    void invalidar();
+
+    std::vector<int> datos_;
+    std::vector<int> copiaOrdenada_;
+    bool copiaValida_;
+
+    mutable bool ordenConocido_;   ///< true si ordenado_ refleja los datos actuales
+    mutable bool ordenado_;
+};
+
+#endif // DATASET_H
@@ -0,0 +1,76 @@
+#pragma once
+/**
+ * @file externalsort.h
+ * @brief Ordenamiento externo de archivos binarios de enteros más grandes que la memoria
+ * @details El archivo se lee en trozos que caben en el presupuesto de memoria, cada trozo se
+ *          ordena con ordenarAuto y se escribe como corrida temporal; luego las corridas se
+ *          mezclan de a k con un árbol de perdedores y E/S secuencial con buffers grandes.
+ *          Formato: enteros de 32 bits consecutivos en el orden de bytes de la máquina.
+ */
+
+#ifndef EXTERNALSORT_H
+#define EXTERNALSORT_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @struct ConfigOrdenamientoExterno
+ * @brief Parámetros del ordenamiento externo
+ */
+struct ConfigOrdenamientoExterno
+{
+    std::size_t memoriaBytes = 64u << 20;   ///< Presupuesto de memoria para trozos y buffers de mezcla
+    std::string directorioTemporal;         ///< Dónde van las corridas; vacío = directorio temporal del sistema
+    bool verbose = false;                   ///< Si true, muestra cada corrida y cada pasada de mezcla
+};
+
+/**
+ * @struct ResultadoOrdenamientoExterno
+ * @brief Lo que midió una ejecución del ordenamiento externo
+ */
+struct ResultadoOrdenamientoExterno
+{
+    bool exito = false;          ///< false si hubo un error de E/S (ver error)
+    std::string error;           ///< Descripción del error, vacío si exito
+    long long elementos = 0;     ///< Enteros ordenados
+    int corridas = 0;            ///< Corridas iniciales generadas
+    int pasadasMezcla = 0;       ///< Pasadas de mezcla k-way (0 si cupo todo en una corrida)
+    double segundos = 0.0;       ///< Tiempo total
+    double mbPorSegundo = 0.0;   ///< Tamaño del archivo (MB) / segundos
+};
+
+/**
+ * @brief Ordena un archivo binario de enteros usando memoria acotada
+ * @param entrada Ruta del archivo a ordenar
+ * @param salida Ruta del archivo ordenado (puede ser la misma que entrada)
+ * @param config Presupuesto de memoria y directorio temporal
+ * @return ResultadoOrdenamientoExterno Conteos, tiempo y throughput, o el error ocurrido
+ * @complexity O(n log n) comparaciones; O(n · (1 + pasadas)) lecturas y escrituras,
+ *             con pasadas = ceil(log_k(corridas)) y k limitado por la memoria
+ * @spacecomplexity O(memoriaBytes)
+ */
+ResultadoOrdenamientoExterno ordenarArchivoExterno(const std::string& entrada, const std::string& salida,
+                                                   const ConfigOrdenamientoExterno& config = ConfigOrdenamientoExterno());
+
+/**
+ * @brief Escribe un archivo binario con n enteros aleatorios en [minVal, maxVal]
+ * @param ruta Archivo a crear (se sobrescribe)
+ * @param n Cantidad de enteros (puede superar el límite de los arreglos en memoria)
+ * @param minVal Valor mínimo
+ * @param maxVal Valor máximo
+ * @return bool true si se escribió completo
+ * @complexity O(n) con memoria O(1)
+ */
+bool generarArchivoBinario(const std::string& ruta, long long n, int minVal, int maxVal);
+
+/**
+ * @brief Revisa que un archivo binario de enteros esté en orden no decreciente
+ * @param ruta Archivo a revisar
+ * @param elementos Si no es nullptr, recibe la cantidad de enteros leídos
+ * @return bool true si se pudo leer y está ordenado
+ * @complexity O(n) con memoria O(1)
+ */
+bool verificarArchivoOrdenado(const std::string& ruta, long long* elementos = nullptr);
+
+#endif // EXTERNALSORT_H
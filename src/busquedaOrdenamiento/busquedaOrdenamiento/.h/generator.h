@@ -9,6 +9,7 @@
 
 #include <vector>
 #include <random>
+#include <string>
 
  /**
   * @brief Genera un arreglo de enteros aleatorios
@@ -35,4 +36,63 @@ std::vector<int> generarArregloInteractivo(int& outN);
  */
 std::mt19937& rngGlobal();
 
+/**
+ * @enum Distribucion
+ * @brief Formas de entrada para comparar algoritmos ms all del caso aleatorio
+ */
+enum class Distribucion {
+    Uniforme,       ///< Valores uniformes en 1..100000
+    Ordenado,       ///< Ya ordenado ascendente
+    CasiOrdenado,   ///< Ordenado con ~1% de elementos movidos unas pocas posiciones
+    Invertido,      ///< Ordenado descendente
+    RangoEstrecho,  ///< Valores en 0..99 (muchos repetidos)
+    OrganPipe,      ///< 0, 1, ..., n/2, ..., 1, 0
+    LotesAgregados, ///< Bloque grande ordenado seguido de 8 lotes ordenados agregados al final
+    Sesgada         ///< Log-uniforme en 1..2^30: la mayora de los valores son chicos y la cola es larga
+};
+
+/**
+ * @brief Genera un arreglo con la distribucin pedida
+ * @param n Tamao del arreglo
+ * @param d Distribucin de los valores
+ * @return std::vector<int> Vector generado
+ * @complexity O(n log n) para las variantes que parten de un arreglo ordenado, O(n) el resto
+ */
+std::vector<int> generarArregloDistribucion(int n, Distribucion d);
+
+/**
+ * @brief Nombre corto de una distribucin (para reportes y CSV)
+ * @param d Distribucin
+ * @return const char* Nombre sin espacios
+ * @complexity O(1)
+ */
+const char* nombreDistribucion(Distribucion d);
+
+/**
+ * @enum TipoCadena
+ * @brief Formas de claves de texto para probar ordenamiento de cadenas
+ */
+enum class TipoCadena {
+    Aleatoria,      ///< 8 a 24 letras minsculas al azar
+    PrefijoComun,   ///< Prefijo fijo de 20 caracteres + 8 caracteres al azar
+    TipoUrl         ///< "https://www.<dominio>.com/<ruta>/<ruta>?id=<n>" con pocos dominios
+};
+
+/**
+ * @brief Genera n cadenas aleatorias del tipo pedido (contraparte de generarArreglo)
+ * @param n Cantidad de cadenas
+ * @param tipo Forma de las cadenas
+ * @return std::vector<std::string> Cadenas generadas (pueden repetirse)
+ * @complexity O(n  L) con L el largo medio de las cadenas
+ */
+std::vector<std::string> generarCadenas(int n, TipoCadena tipo);
+
+/**
+ * @brief Nombre corto de un tipo de cadena (para reportes y CSV)
+ * @param tipo Tipo de cadena
+ * @return const char* Nombre sin espacios
+ * @complexity O(1)
+ */
+const char* nombreTipoCadena(TipoCadena tipo);
+
 #endif // GENERATOR_H
\ No newline at end of file
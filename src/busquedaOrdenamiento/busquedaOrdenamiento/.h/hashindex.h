@@ -0,0 +1,83 @@
+#pragma once
+/**
+ * @file hashindex.h
+ * @brief Índice hash de direccionamiento abierto: valor -> primera posición en O(1)
+ * @details Tabla plana con sondeo lineal. Cada ranura guarda clave y posición juntas
+ *          (8 bytes), así que una búsqueda exitosa casi siempre lee una sola línea de caché.
+ *          La capacidad es potencia de 2 y al menos el doble de los elementos (carga <= 0.5),
+ *          lo que mantiene las cadenas de sondeo cortas incluso con claves agrupadas.
+ */
+
+#ifndef HASHINDEX_H
+#define HASHINDEX_H
+
+#include <vector>
+
+/**
+ * @class IndiceHash
+ * @brief Índice de coincidencia exacta que responde lo mismo que busquedaSecuencial
+ */
+class IndiceHash
+{
+public:
+    /**
+     * @brief Índice vacío (buscar devuelve siempre -1 hasta reconstruir)
+     * @complexity O(1)
+     */
+    IndiceHash();
+
+    /**
+     * @brief Construye el índice sobre el arreglo
+     * @param a Arreglo en cualquier orden (no se guarda: si cambia, hay que reconstruir)
+     * @param n Tamaño del arreglo
+     * @complexity O(n) esperado
+     * @spacecomplexity O(n) - entre 16 y 32 bytes por elemento
+     */
+    IndiceHash(const int* a, int n);
+
+    /**
+     * @brief Vuelve a construir el índice para un arreglo nuevo o modificado (p. ej. al regenerar)
+     * @param a Arreglo en cualquier orden
+     * @param n Tamaño del arreglo
+     * @complexity O(n) esperado; reutiliza la tabla si ya tiene capacidad suficiente
+     */
+    void reconstruir(const int* a, int n);
+
+    /**
+     * @brief Posición más baja con a[i] == valor en el arreglo indexado
+     * @param valor Valor buscado
+     * @return int Posición o -1 (igual que busquedaSecuencial)
+     * @complexity O(1) esperado
+     */
+    int buscar(int valor) const;
+
+    /**
+     * @brief Valores distintos indexados
+     * @return int Claves en la tabla
+     * @complexity O(1)
+     */
+    int claves() const { return claves_; }
+
+    /**
+     * @brief Memoria de la tabla
+     * @return long long Bytes
+     * @complexity O(1)
+     */
+    long long bytes() const { return (long long)tabla_.size() * sizeof(Ranura); }
+
+private:
+    struct Ranura
+    {
+        int clave;
+        int posicion;   ///< -1 = ranura libre
+    };
+
+    unsigned int ranuraInicial(int valor) const;
+
+    std::vector<Ranura> tabla_;
+    unsigned int mascara_;
+    int desplazamiento_;   ///< 32 - log2(capacidad): se usan los bits altos del producto
+    int claves_;
+};
+
+#endif // HASHINDEX_H
@@ -0,0 +1,88 @@
+#pragma once
+/**
+ * @file interpsearch.h
+ * @brief Búsquedas que usan el valor para estimar la posición: interpolación, exponencial e
+ *        índice aprendido (modelo lineal por tramos con error acotado)
+ * @details Todas devuelven la posición de la primera aparición del valor en el arreglo
+ *          ordenado, o -1, igual que los índices de searchindex.h.
+ */
+
+#ifndef INTERPSEARCH_H
+#define INTERPSEARCH_H
+
+#include <vector>
+
+/**
+ * @brief Búsqueda por interpolación con respaldo binario
+ * @param a Arreglo ordenado ascendente
+ * @param n Tamaño del arreglo
+ * @param valor Valor buscado
+ * @return int Primera posición de valor o -1
+ * @complexity O(log log n) con claves uniformes; cada paso de interpolación que no reduce el
+ *             rango a la mitad va seguido de uno binario, así que nunca pasa de O(log n)
+ */
+int busquedaInterpolacion(const int* a, int n, int valor);
+
+/**
+ * @brief Búsqueda exponencial (galope): duplica el salto desde el inicio y termina con binaria
+ * @param a Arreglo ordenado ascendente
+ * @param n Tamaño del arreglo
+ * @param valor Valor buscado
+ * @return int Primera posición de valor o -1
+ * @complexity O(log p) con p la posición de la respuesta: conviene si suele estar cerca del inicio
+ */
+int busquedaExponencial(const int* a, int n, int valor);
+
+/**
+ * @class IndiceAprendido
+ * @brief Índice aprendido: recta por tramos que predice la posición con error <= epsilon
+ * @details Se construye en una pasada con el método del cono (cada tramo se extiende mientras
+ *          exista una pendiente que deje todos sus puntos a <= epsilon de su posición real).
+ *          La consulta busca el tramo (binaria sobre las claves iniciales de los tramos),
+ *          evalúa la recta y termina con una búsqueda binaria en una ventana de 2·epsilon + 2.
+ */
+class IndiceAprendido
+{
+public:
+    /**
+     * @brief Construye el modelo sobre el arreglo ordenado
+     * @param ordenado Arreglo ordenado ascendente (no se copia: debe seguir vivo y sin cambios)
+     * @param n Tamaño del arreglo
+     * @param epsilon Error máximo de la predicción en posiciones (>= 1)
+     * @complexity O(n)
+     * @spacecomplexity O(tramos)
+     */
+    IndiceAprendido(const int* ordenado, int n, int epsilon = 32);
+
+    /**
+     * @brief Posición de la primera aparición de valor
+     * @param valor Valor buscado
+     * @return int Posición o -1
+     * @complexity O(log tramos + log epsilon)
+     */
+    int buscar(int valor) const;
+
+    /**
+     * @brief Cantidad de tramos lineales del modelo
+     * @return int Tramos
+     * @complexity O(1)
+     */
+    int tramos() const { return (int)claveInicio_.size(); }
+
+    /**
+     * @brief Memoria del modelo (sin contar el arreglo)
+     * @return long long Bytes
+     * @complexity O(1)
+     */
+    long long bytesModelo() const;
+
+private:
+    const int* a_;
+    int n_;
+    int epsilon_;
+    std::vector<int> claveInicio_;      ///< Primera clave de cada tramo (ordenadas)
+    std::vector<int> posicionInicio_;   ///< Posición de esa clave
+    std::vector<double> pendiente_;     ///< Posiciones por unidad de clave en el tramo
+};
+
+#endif // INTERPSEARCH_H
@@ -0,0 +1,35 @@
+#pragma once
+/**
+ * @file memoria.h
+ * @brief Contabilidad de memoria dinámica para reportar el pico extra de cada algoritmo
+ * @details memoria.cpp reemplaza los operator new / delete globales (sin alineación
+ *          extendida) y lleva la cuenta de los bytes vivos y del máximo alcanzado.
+ *          Todo lo que pase por new, incluidos std::vector y los hilos del pool, cuenta.
+ */
+
+#ifndef MEMORIA_H
+#define MEMORIA_H
+
+#include <cstddef>
+
+/**
+ * @brief Bytes reservados con new que siguen vivos
+ * @return std::size_t Bytes en uso (sin contar los encabezados internos)
+ * @complexity O(1)
+ */
+std::size_t memoriaEnUso();
+
+/**
+ * @brief Toma el uso actual como línea base y reinicia el pico a ese valor
+ * @complexity O(1)
+ */
+void memoriaReiniciarPico();
+
+/**
+ * @brief Máximo de bytes vivos por encima de la línea base desde el último reinicio
+ * @return std::size_t Pico extra en bytes
+ * @complexity O(1)
+ */
+std::size_t memoriaPicoExtra();
+
+#endif // MEMORIA_H
@@ -8,52 +8,66 @@
 #ifndef MENU_H
 #define MENU_H
 
+#include "dataset.h"
+
 #include <vector>
 
  /**
   * @brief Ejecuta el bucle principal del menú interactivo
   * @details Controla el flujo principal del programa mostrando opciones
   *          y delegando a las funciones correspondientes
-  * @complexity O(k × n²) peor caso, O(k × n log n) promedio donde k es
-  *             la cantidad de operaciones del usuario
+  * @complexity O(k × n²) peor caso (métodos cuadráticos elegidos a mano),
+  *             O(k × n log n) promedio donde k es la cantidad de operaciones del usuario
   */
 void ejecutarMenuPrincipal();
 
 /**
  * @brief Maneja la opción de regenerar el arreglo
- * @param arregloVec Referencia al vector de enteros a regenerar
- * @param n Referencia al tamaño actual del arreglo
+ * @param datos Conjunto a regenerar (se invalida su copia ordenada)
  * @param verbose Referencia al flag de modo detallado
  * @complexity O(n) - Depende del tamaño del nuevo arreglo generado
  */
-void manejarRegeneracion(std::vector<int>& arregloVec, int& n, bool& verbose);
+void manejarRegeneracion(ConjuntoDatos& datos, bool& verbose);
 
 /**
  * @brief Ejecuta búsqueda secuencial sobre el arreglo
- * @param arregloVec Vector de enteros (puede estar desordenado)
- * @param n Tamaño del arreglo
+ * @param datos Conjunto de datos (puede estar desordenado)
  * @param verbose Si true, muestra proceso paso a paso
  * @complexity O(n) - Búsqueda lineal completa en peor caso
  */
-void manejarBusquedaSecuencial(const std::vector<int>& arregloVec, int n, bool verbose);
+void manejarBusquedaSecuencial(const ConjuntoDatos& datos, bool verbose);
 
 /**
- * @brief Ordena con burbuja y ejecuta búsqueda binaria
- * @param arregloVec Vector de enteros (se modifica ordenándolo)
- * @param n Tamaño del arreglo
+ * @brief Ejecuta búsqueda binaria sobre la versión ordenada del conjunto
+ * @param datos Conjunto de datos (su orden no cambia; la copia ordenada queda en caché)
  * @param verbose Si true, muestra proceso paso a paso
- * @complexity O(n²) - Dominado por ordenamiento burbuja
+ * @complexity O(n log n) la primera vez después de un cambio de datos, O(log n) las siguientes
  */
-void manejarBusquedaBinaria(std::vector<int>& arregloVec, int n, bool verbose);
+void manejarBusquedaBinaria(ConjuntoDatos& datos, bool verbose);
 
 /**
  * @brief Muestra menú de ordenamiento y ejecuta método seleccionado
- * @param arregloVec Vector de enteros a ordenar (se modifica)
- * @param n Tamaño del arreglo
+ * @param datos Conjunto a ordenar (se modifica y se invalida su copia ordenada)
  * @param verbose Si true, muestra proceso paso a paso
  * @complexity Variable: O(n²) a O(n log n) según método elegido
  */
-void manejarOrdenamiento(std::vector<int>& arregloVec, int n, bool verbose);
+void manejarOrdenamiento(ConjuntoDatos& datos, bool verbose);
+
+/**
+ * @brief Muestra el submenú de selección y ejecuta la operación elegida sobre una copia
+ * @param datos Conjunto de datos (no se modifica)
+ * @param verbose Si true, muestra las particiones de la selección
+ * @complexity O(n) promedio para el k-ésimo, O(n + k log k) para los k menores,
+ *             O(n log k) para los k mayores
+ */
+void manejarSeleccion(const ConjuntoDatos& datos, bool verbose);
+
+/**
+ * @brief Ordena un archivo binario de enteros con memoria acotada (genera uno si se pide)
+ * @param verbose Si true, muestra cada corrida y cada pasada de mezcla
+ * @complexity O(n log n) comparaciones y O(n · pasadas) de E/S secuencial
+ */
+void manejarOrdenamientoExterno(bool verbose);
 
 /**
  * @brief Ejecuta benchmarks automáticos y exporta resultados
@@ -69,11 +83,18 @@ void mostrarMenu();
 
 /**
  * @brief Muestra el submenú de métodos de ordenamiento
- * @return int Opción seleccionada por el usuario (1-5)
+ * @return int Opción seleccionada por el usuario (1-14)
  * @complexity O(1) - Solo impresión y lectura
  */
 int mostrarMenuOrdenamiento();
 
+/**
+ * @brief Muestra el submenú de selección
+ * @return int Opción seleccionada por el usuario (1-3)
+ * @complexity O(1) - Solo impresión y lectura
+ */
+int mostrarMenuSeleccion();
+
 /**
  * @brief Solicita al usuario un valor entero para búsqueda
  * @return int Valor ingresado por el usuario
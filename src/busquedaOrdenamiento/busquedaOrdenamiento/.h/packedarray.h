@@ -0,0 +1,107 @@
+#pragma once
+/**
+ * @file packedarray.h
+ * @brief Arreglo ordenado comprimido en bloques empaquetados por bits, con búsqueda sin descomprimir todo
+ * @details El arreglo se corta en bloques de 128 valores. Cada bloque guarda sus valores como
+ *          distancia a la cabeza del bloque (frame of reference) con el mínimo ancho de bits
+ *          que alcanza para el mayor. Las cabezas quedan sin comprimir en un arreglo aparte:
+ *          una búsqueda binaria sobre ellas elige el bloque y sólo ese bloque se decodifica.
+ *          Dentro del bloque los valores se intercalan en 4 carriles de 32 bits, así que el
+ *          desempaquetado con SSE2 produce 4 valores consecutivos por instrucción.
+ */
+
+#ifndef PACKEDARRAY_H
+#define PACKEDARRAY_H
+
+#include <cstdint>
+#include <vector>
+
+/// Valores por bloque comprimido
+const int VALORES_POR_BLOQUE = 128;
+
+/**
+ * @class ArregloComprimido
+ * @brief Copia comprimida de solo lectura de un arreglo ordenado
+ */
+class ArregloComprimido
+{
+public:
+    /**
+     * @brief Comprime el arreglo
+     * @param ordenado Arreglo ordenado ascendente (se copia: el original puede liberarse)
+     * @param n Tamaño del arreglo
+     * @complexity O(n)
+     * @spacecomplexity O(n·w/32) palabras, con w el ancho de bits de cada bloque, más 12 bytes
+     *                  por bloque de cabeza, ancho y desplazamiento
+     */
+    ArregloComprimido(const int* ordenado, int n);
+
+    /**
+     * @brief Primera posición de valor en el arreglo original (como los índices de searchindex.h)
+     * @param valor Valor buscado
+     * @return int Posición o -1
+     * @complexity O(log(n/128)) sobre las cabezas + O(128) para decodificar un bloque
+     */
+    int buscar(int valor) const;
+
+    /**
+     * @brief Decodifica un bloque completo
+     * @param bloque Índice del bloque (0..bloques()-1)
+     * @param salida Destino con lugar para VALORES_POR_BLOQUE enteros (el último bloque se
+     *               completa repitiendo su último valor)
+     * @return int Valores válidos del bloque
+     * @complexity O(128)
+     */
+    int decodificarBloque(int bloque, int* salida) const;
+
+    /**
+     * @brief Reconstruye el arreglo original entero
+     * @param salida Destino con lugar para tamano() enteros
+     * @complexity O(n)
+     */
+    void descomprimir(int* salida) const;
+
+    /**
+     * @brief Cantidad de valores comprimidos
+     * @return int n
+     * @complexity O(1)
+     */
+    int tamano() const { return n_; }
+
+    /**
+     * @brief Cantidad de bloques de VALORES_POR_BLOQUE valores
+     * @return int Bloques (el último puede estar incompleto)
+     * @complexity O(1)
+     */
+    int bloques() const { return (int)cabezas_.size(); }
+
+    /**
+     * @brief Memoria total de la representación comprimida
+     * @return long long Bytes de datos empaquetados más cabezas, anchos y desplazamientos
+     * @complexity O(1)
+     */
+    long long bytes() const;
+
+    /**
+     * @brief Bytes del arreglo sin comprimir dividido bytes()
+     * @return double Razón de compresión (mayor que 1 = ahorra memoria)
+     * @complexity O(1)
+     */
+    double razonCompresion() const;
+
+    /**
+     * @brief Nivel de desempaquetado compilado
+     * @return const char* "SSE2" o "Escalar"
+     * @complexity O(1)
+     */
+    static const char* nivelDesempaquetado();
+
+private:
+    std::vector<int> cabezas_;                 ///< Primer valor de cada bloque (sin comprimir)
+    std::vector<std::uint8_t> anchos_;         ///< Bits por valor de cada bloque (0..32)
+    std::vector<std::uint32_t> inicios_;       ///< Primera palabra de cada bloque en datos_
+    std::vector<std::uint32_t> datos_;         ///< Palabras empaquetadas de todos los bloques
+    int n_;
+};
+
+#endif // PACKEDARRAY_H
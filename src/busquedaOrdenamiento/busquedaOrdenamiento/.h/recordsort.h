@@ -0,0 +1,91 @@
+#pragma once
+/**
+ * @file recordsort.h
+ * @brief Ordenamiento de registros por clave sin mover los datos: argsort y gather
+ * @details Las claves se manejan en estructura de arreglos (claves contiguas + índices
+ *          paralelos) para que cada pasada recorra sólo 8 bytes por registro. El resultado
+ *          es una permutación; los registros se reubican después en un solo recorrido
+ *          (gather), o nunca si alcanza con recorrerlos en orden a través de la permutación.
+ */
+
+#ifndef RECORDSORT_H
+#define RECORDSORT_H
+
+#include <vector>
+
+/**
+ * @enum ModoOrdenRegistros
+ * @brief Garantía de orden entre registros con la misma clave
+ */
+enum class ModoOrdenRegistros {
+    Estable,    ///< Claves iguales conservan su orden original (radix LSD sobre clave + índice)
+    Inestable   ///< Sin garantía para claves iguales (introsort sobre pares clave-índice)
+};
+
+/**
+ * @brief Ordena claves[] y reordena indices[] con la misma permutación (estructura de arreglos)
+ * @param claves Claves a ordenar (se modifican)
+ * @param indices Arreglo paralelo que acompaña a cada clave (índices o cualquier id de 32 bits)
+ * @param n Cantidad de registros
+ * @param modo Estable o inestable
+ * @complexity Estable: O(n) en 3 pasadas de 11 bits; Inestable: O(n log n)
+ * @spacecomplexity Estable: O(n) de buffers; Inestable: O(n) para los pares
+ */
+void ordenarClavesConIndices(int* claves, int* indices, int n, ModoOrdenRegistros modo = ModoOrdenRegistros::Estable);
+
+/**
+ * @brief Permutación que ordena las claves, sin modificarlas
+ * @param claves Claves de los registros (contiguas)
+ * @param n Cantidad de registros
+ * @param modo Estable o inestable
+ * @return std::vector<int> p tal que claves[p[0]] <= claves[p[1]] <= ... <= claves[p[n-1]]
+ * @complexity Igual que ordenarClavesConIndices
+ */
+std::vector<int> argsort(const int* claves, int n, ModoOrdenRegistros modo = ModoOrdenRegistros::Estable);
+
+/**
+ * @brief Gather: destino[i] = origen[permutacion[i]]
+ * @param permutacion Resultado de argsort
+ * @param origen Registros en el orden original
+ * @param destino Espacio para permutacion.size() registros (no debe solaparse con origen)
+ * @complexity O(n) - Lecturas dispersas y escrituras secuenciales
+ */
+template <typename T>
+void aplicarPermutacion(const std::vector<int>& permutacion, const T* origen, T* destino)
+{
+    const int n = (int)permutacion.size();
+    for (int i = 0; i < n; i++) destino[i] = origen[permutacion[i]];
+}
+
+/**
+ * @brief Reordena datos en el lugar según una permutación de argsort (sigue sus ciclos)
+ * @param permutacion Resultado de argsort (se usa como copia de trabajo)
+ * @param datos Registros a reordenar: al final datos[i] es el antiguo datos[permutacion[i]]
+ * @complexity O(n) movimientos
+ * @spacecomplexity O(n) enteros: la copia de la permutación, donde se marcan con -1 las
+ *                  posiciones resueltas
+ */
+template <typename T>
+void permutarEnSitio(std::vector<int> permutacion, T* datos)
+{
+    const int n = (int)permutacion.size();
+    for (int inicio = 0; inicio < n; inicio++)
+    {
+        if (permutacion[inicio] < 0 || permutacion[inicio] == inicio) continue;
+
+        // Recorre el ciclo que empieza en inicio marcando cada posición ya resuelta con -1
+        T temp = datos[inicio];
+        int actual = inicio;
+        while (permutacion[actual] != inicio)
+        {
+            int siguiente = permutacion[actual];
+            datos[actual] = datos[siguiente];
+            permutacion[actual] = -1;
+            actual = siguiente;
+        }
+        datos[actual] = temp;
+        permutacion[actual] = -1;
+    }
+}
+
+#endif // RECORDSORT_H
@@ -4,6 +4,6 @@
 
 // 0/ verbose=true imprime el proceso paso a paso
 int busquedaSecuencial(const int* arr, int n, int valor, bool verbose);
-int busquedaBinaria(int arreglo[], int n, int valor, bool verbose = false);
+int busquedaBinaria(const int arreglo[], int n, int valor, bool verbose = false);
 
 #endif
\ No newline at end of file
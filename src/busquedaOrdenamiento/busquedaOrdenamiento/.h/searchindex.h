@@ -0,0 +1,114 @@
+#pragma once
+/**
+ * @file searchindex.h
+ * @brief Índices de búsqueda estáticos con disposición amigable para la caché
+ * @details Se construyen una vez a partir de un arreglo ordenado y responden con la posición
+ *          de la primera aparición del valor en ese arreglo (la de una búsqueda binaria de
+ *          cota inferior), o -1. Con valores repetidos esto difiere a propósito de
+ *          busquedaBinaria, que devuelve la aparición donde cae su bisección: la primera
+ *          aparición no depende del recorrido y coincide con la de IndiceHash, IndiceAprendido
+ *          y ArregloComprimido. Sin repetidos las respuestas son idénticas.
+ *          - IndiceEytzinger: el arreglo en orden BFS (hijos de k en 2k y 2k+1). Los primeros
+ *            niveles quedan juntos en caché y los 16 nietos de cuarto nivel de un nodo ocupan
+ *            una sola línea de 64 bytes, que se precarga mientras se recorren los niveles
+ *            intermedios. La bajada no tiene saltos condicionales.
+ *          - IndiceArbolB: árbol B estático implícito con nodos de 16 claves (una línea de caché).
+ *            En cada nodo se comparan las 16 claves a la vez con SIMD y la cantidad de claves
+ *            menores es el hijo por el que se baja: log17(n) líneas por búsqueda.
+ */
+
+#ifndef SEARCHINDEX_H
+#define SEARCHINDEX_H
+
+#include <vector>
+
+/**
+ * @class IndiceEytzinger
+ * @brief Búsqueda de cota inferior sin saltos sobre la disposición de Eytzinger
+ */
+class IndiceEytzinger
+{
+public:
+    /**
+     * @brief Construye el índice
+     * @param ordenado Arreglo ordenado ascendente (se copia; después se puede liberar)
+     * @param n Tamaño del arreglo
+     * @complexity O(n)
+     * @spacecomplexity O(n) - claves y posiciones originales
+     */
+    IndiceEytzinger(const int* ordenado, int n);
+
+    IndiceEytzinger(const IndiceEytzinger&) = delete;
+    IndiceEytzinger& operator=(const IndiceEytzinger&) = delete;
+    IndiceEytzinger(IndiceEytzinger&&) = default;
+    IndiceEytzinger& operator=(IndiceEytzinger&&) = default;
+
+    /**
+     * @brief Posición en el arreglo original de la primera aparición de valor
+     * @param valor Valor buscado
+     * @return int Posición o -1
+     * @complexity O(log n)
+     */
+    int buscar(int valor) const;
+
+    /**
+     * @brief Cantidad de claves indexadas
+     * @return int n
+     * @complexity O(1)
+     */
+    int tamano() const { return n_; }
+
+private:
+    int n_;
+    std::vector<int> almacen_;       ///< Reserva con margen para alinear claves_ a 64 bytes
+    int* claves_;                    ///< claves_[1..n] en orden BFS
+    std::vector<int> posiciones_;    ///< posiciones_[k] = índice original de claves_[k]
+};
+
+/**
+ * @class IndiceArbolB
+ * @brief Árbol B estático (S-tree) con nodos de 16 claves y comparación SIMD por nodo
+ */
+class IndiceArbolB
+{
+public:
+    static const int B = 16;   ///< Claves por nodo: 64 bytes, una línea de caché
+
+    /**
+     * @brief Construye el índice
+     * @param ordenado Arreglo ordenado ascendente (se copia; después se puede liberar)
+     * @param n Tamaño del arreglo
+     * @complexity O(n)
+     * @spacecomplexity O(n) - claves (rellenadas hasta múltiplo de 16) y posiciones
+     */
+    IndiceArbolB(const int* ordenado, int n);
+
+    IndiceArbolB(const IndiceArbolB&) = delete;
+    IndiceArbolB& operator=(const IndiceArbolB&) = delete;
+    IndiceArbolB(IndiceArbolB&&) = default;
+    IndiceArbolB& operator=(IndiceArbolB&&) = default;
+
+    /**
+     * @brief Posición en el arreglo original de la primera aparición de valor
+     * @param valor Valor buscado
+     * @return int Posición o -1
+     * @complexity O(log_17 n) nodos, O(1) comparaciones vectoriales por nodo
+     */
+    int buscar(int valor) const;
+
+    /**
+     * @brief Cantidad de claves indexadas
+     * @return int n
+     * @complexity O(1)
+     */
+    int tamano() const { return n_; }
+
+private:
+    int n_;
+    int nodos_;
+    std::vector<int> almacen_;       ///< Reserva con margen para alinear claves_ a 64 bytes
+    int* claves_;                    ///< Nodo k en claves_[k*B .. k*B+B-1]
+    std::vector<int> posiciones_;    ///< Índice original de cada ranura (n en las de relleno)
+};
+
+#endif // SEARCHINDEX_H
@@ -0,0 +1,75 @@
+#pragma once
+/**
+ * @file searchsimd.h
+ * @brief Búsqueda secuencial vectorizada sobre enteros: primera aparición, conteo y todas las posiciones
+ * @details Con AVX2 se comparan 8 enteros por instrucción (32 por vuelta), con SSE2 4 (16 por
+ *          vuelta) y sin ninguna de las dos se usa un bucle escalar. La máscara de la comparación
+ *          (movemask) dice en un solo salto si hubo coincidencia en el bloque, así que la búsqueda
+ *          de la primera aparición corta apenas la encuentra. buscarPrimeroParalelo reparte
+ *          el mismo recorrido entre los hilos del pool compartido.
+ */
+
+#ifndef SEARCHSIMD_H
+#define SEARCHSIMD_H
+
+/**
+ * @brief Primera posición de valor en el arreglo (misma semántica que busquedaSecuencial)
+ * @param a Arreglo (no se modifica)
+ * @param n Tamaño del arreglo
+ * @param valor Valor buscado
+ * @return int Posición más baja con a[i] == valor, o -1
+ * @complexity O(n), con n/8 comparaciones vectoriales en AVX2
+ */
+int buscarPrimeroSimd(const int* a, int n, int valor);
+
+/**
+ * @brief Primera posición de valor recorriendo el arreglo con varios hilos
+ * @param a Arreglo (no se modifica)
+ * @param n Tamaño del arreglo
+ * @param valor Valor buscado
+ * @param hilos Hilos a usar (<= 0 usa todos los núcleos)
+ * @return int Posición más baja con a[i] == valor, o -1 (igual que buscarPrimeroSimd)
+ * @complexity O(n / hilos) si no aparece; si aparece en p, O(p / hilos + bloque)
+ * @details Los hilos toman bloques en orden creciente de un contador atómico y publican la
+ *          mejor posición con un mínimo atómico. Un bloque que empieza después de esa posición
+ *          ya no puede mejorarla, así que el hilo que lo toma termina y los demás también.
+ */
+int buscarPrimeroParalelo(const int* a, int n, int valor, int hilos = 0);
+
+/**
+ * @brief Cantidad de elementos iguales a valor
+ * @param a Arreglo (no se modifica)
+ * @param n Tamaño del arreglo
+ * @param valor Valor buscado
+ * @return int Apariciones de valor
+ * @complexity O(n) - recorre todo el arreglo
+ */
+int contarIgualesSimd(const int* a, int n, int valor);
+
+/**
+ * @brief Escribe en salida las posiciones (crecientes) de todos los elementos iguales a valor
+ * @param a Arreglo (no se modifica)
+ * @param n Tamaño del arreglo
+ * @param valor Valor buscado
+ * @param salida Buffer de posiciones
+ * @param capacidad Posiciones que caben en salida; al llenarse se deja de buscar
+ * @return int Posiciones escritas (<= capacidad)
+ * @complexity O(n + k) con k coincidencias
+ */
+int buscarTodosSimd(const int* a, int n, int valor, int* salida, int capacidad);
+
+/**
+ * @brief Activa o desactiva las rutas vectoriales (para comparar contra la versión escalar)
+ * @param activo true para usarlas (por defecto activas si se compiló con AVX2 o SSE2)
+ * @complexity O(1)
+ */
+void activarBusquedaSimd(bool activo);
+
+/**
+ * @brief Ruta que usan en este momento las funciones de este módulo
+ * @return const char* "AVX2", "SSE2" o "escalar"
+ * @complexity O(1)
+ */
+const char* nivelBusquedaSimd();
+
+#endif // SEARCHSIMD_H
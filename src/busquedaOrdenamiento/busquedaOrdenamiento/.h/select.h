@@ -0,0 +1,95 @@
+#pragma once
+/**
+ * @file select.h
+ * @brief Selección sin ordenar todo: k-ésimo elemento, ordenamiento parcial y top-k
+ * @details Las funciones cuentan comparaciones e intercambios con el mismo esquema de
+ *          parámetros por referencia que quickSort, para comparar contra ordenar completo.
+ */
+
+#ifndef SELECT_H
+#define SELECT_H
+
+#include <vector>
+
+/**
+ * @brief Introselect: deja en arreglo[k] el valor que tendría si el arreglo estuviera ordenado
+ * @param arreglo Arreglo a reordenar
+ * @param n Tamaño del arreglo
+ * @param k Posición buscada (0 = mínimo, n - 1 = máximo)
+ * @param comparaciones Contador de comparaciones (se acumula)
+ * @param intercambios Contador de intercambios (se acumula)
+ * @param verbose Si true, muestra cada partición
+ * @return int El k-ésimo valor; a su izquierda quedan valores <= y a su derecha >=
+ * @complexity O(n) promedio con mediana de tres; si la recursión se profundiza de más
+ *             cambia a mediana de medianas y queda O(n) garantizado
+ */
+int seleccionarK(int arreglo[], int n, int k, int& comparaciones, int& intercambios, bool verbose = false);
+
+/**
+ * @brief Ordena sólo los k menores al comienzo del arreglo (como std::partial_sort)
+ * @param arreglo Arreglo a reordenar
+ * @param n Tamaño del arreglo
+ * @param k Cantidad de menores que quedan ordenados en arreglo[0, k)
+ * @param comparaciones Contador de comparaciones (se acumula)
+ * @param intercambios Contador de intercambios (se acumula)
+ * @param verbose Si true, muestra las particiones de la selección
+ * @complexity O(n + k log k)
+ */
+void ordenarParcial(int arreglo[], int n, int k, int& comparaciones, int& intercambios, bool verbose = false);
+
+/**
+ * @class TopK
+ * @brief Los k mayores de un flujo de valores, con un montículo de mínimos de tamaño k
+ * @details Sirve para datos que llegan de a uno y no caben o no conviene guardarlos.
+ */
+class TopK
+{
+public:
+    /**
+     * @brief Crea el acumulador
+     * @param k Cantidad de mayores a conservar
+     * @complexity O(k) por la reserva del montículo
+     */
+    explicit TopK(int k);
+
+    /**
+     * @brief Ofrece un valor del flujo
+     * @param valor Valor nuevo
+     * @complexity O(1) si no entra, O(log k) si reemplaza al menor conservado
+     */
+    void agregar(int valor);
+
+    /**
+     * @brief Los k mayores vistos hasta ahora, de mayor a menor
+     * @return std::vector<int> Hasta k valores
+     * @complexity O(k log k)
+     */
+    std::vector<int> resultado() const;
+
+    /**
+     * @brief Comparaciones hechas por agregar() hasta ahora
+     * @return int Comparaciones
+     * @complexity O(1)
+     */
+    int comparaciones() const { return comparaciones_; }
+
+private:
+    void hundir(int i);
+
+    int k_;
+    std::vector<int> monticulo_;   ///< Montículo de mínimos: monticulo_[0] es el menor conservado
+    int comparaciones_;
+};
+
+/**
+ * @brief Los k mayores de un arreglo sin modificarlo
+ * @param arreglo Arreglo de entrada
+ * @param n Tamaño del arreglo
+ * @param k Cantidad de mayores
+ * @param comparaciones Contador de comparaciones (se acumula)
+ * @return std::vector<int> Los min(k, n) mayores, de mayor a menor
+ * @complexity O(n log k) peor caso, O(n) si pocos valores desplazan al mínimo del montículo
+ */
+std::vector<int> topK(const int* arreglo, int n, int k, int& comparaciones);
+
+#endif // SELECT_H
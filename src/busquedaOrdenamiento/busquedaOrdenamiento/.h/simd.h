@@ -0,0 +1,62 @@
+#pragma once
+/**
+ * @file simd.h
+ * @brief Detección de las extensiones SIMD disponibles al compilar
+ * @details SIMD_AVX2 se define si el compilador genera AVX2 (/arch:AVX2 en MSVC,
+ *          -mavx2 o -march=native en GCC/Clang). SIMD_SSE2 se define en cualquier
+ *          x86-64 y en x86 con SSE2. Sin ninguna de las dos se usa código escalar.
+ */
+
+#ifndef SIMD_H
+#define SIMD_H
+
+#if defined(__AVX2__)
+#define SIMD_AVX2 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIMD_SSE2 1
+#endif
+
+#if defined(SIMD_AVX2) || defined(SIMD_SSE2)
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * @brief Índice del bit menos significativo encendido
+ * @param m Máscara distinta de cero (por ejemplo, la de un movemask)
+ * @return int Posición del bit (0..31)
+ * @complexity O(1)
+ */
+static inline int primerBitEncendido(unsigned int m)
+{
+#if defined(_MSC_VER)
+    unsigned long i;
+    _BitScanForward(&i, m);
+    return (int)i;
+#else
+    return __builtin_ctz(m);
+#endif
+}
+
+/**
+ * @brief Pide al procesador que traiga a caché la línea de p (sólo una pista: no falla si p es inválido)
+ * @param p Dirección que se va a leer pronto
+ * @complexity O(1)
+ */
+static inline void precargarLectura(const void* p)
+{
+#if defined(SIMD_SSE2)
+    _mm_prefetch((const char*)p, _MM_HINT_T0);
+#elif defined(__GNUC__)
+    __builtin_prefetch(p);
+#else
+    (void)p;
+#endif
+}
+
+#endif // SIMD_H
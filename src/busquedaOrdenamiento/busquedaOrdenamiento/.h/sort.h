@@ -7,6 +7,60 @@ void ordenarBurbuja(int arreglo[], int n, bool verbose = false);
 void ordenarSeleccion(int arreglo[], int n, bool verbose = false);
 void ordenarInsercion(int arreglo[], int n, bool verbose = false);
 void quickSort(int arreglo[], int izquierda, int derecha, int& comparaciones, int& intercambios, bool verbose = false);
+
+// 0/ QuickSort introspectivo: pivote por mediana de tres / ninther, recursión sólo sobre el
+// 0/ lado menor, inserción en particiones chicas y heapsort si la profundidad pasa 2*log2(n)
+void introSort(int arreglo[], int izquierda, int derecha, int& comparaciones, int& intercambios, bool verbose = false);
+
+// 0/ QuickSort con partición por bloques sin saltos (estilo BlockQuicksort): junta en buffers
+// 0/ los desplazamientos de los elementos mal ubicados y los intercambia en lote
+void quickSortBloques(int arreglo[], int izquierda, int derecha, int& comparaciones, int& intercambios, bool verbose = false);
+
+// 0/ Sample sort paralelo: separadores tomados de una muestra, dispersión a cubetas en un solo
+// 0/ recorrido y cada cubeta ordenada como tarea independiente. hilos<=0 usa todos los núcleos
+void sampleSortParalelo(int arreglo[], int n, int hilos = 0);
+
+// 0/ Radix sort LSD sin comparaciones (dígitos de 11 bits, acepta negativos).
+// 0/ Omite las pasadas en las que todos los elementos tienen el mismo dígito
+void ordenarRadix(int arreglo[], int n, bool verbose = false);
+
+// 0/ Motores entre los que elige ordenarAuto
+enum class MotorOrdenamiento { Ninguno, Invertir, Insercion, Conteo, Radix, QuickSortBloques, Timsort };
+
+// 0/ Lo que ordenarAuto midió del arreglo y el motor que eligió
+struct PerfilArreglo
+{
+    int n = 0;
+    int descensos = 0;              // 0/ posiciones con a[i] > a[i+1]
+    int corridas = 0;               // 0/ corridas ascendentes maximales (descensos + 1)
+    int minimo = 0;
+    int maximo = 0;
+    double ratioDuplicados = 0.0;   // 0/ estimado sobre una muestra
+    MotorOrdenamiento motor = MotorOrdenamiento::Ninguno;
+};
+
+// 0/ Revisa el arreglo (orden previo, corridas, rango y duplicados) y ordena con el motor que
+// 0/ mejor le queda. Devuelve el motor usado; si perfil != nullptr deja ahí lo medido
+MotorOrdenamiento ordenarAuto(int arreglo[], int n, PerfilArreglo* perfil = nullptr);
+const char* nombreMotor(MotorOrdenamiento motor);
 void mergeSort(int arreglo[], int izquierda, int derecha, int& comparaciones, bool verbose = false);
 
+// 0/ MergeSort iterativo de abajo hacia arriba con un solo buffer de n enteros.
+// 0/ buffer (opcional) debe tener al menos n posiciones; si es nullptr se reserva uno interno
+void mergeSortIterativo(int arreglo[], int n, int& comparaciones, int* buffer = nullptr, bool verbose = false);
+
+// 0/ Merge sort natural estilo Timsort: detecta corridas ascendentes y descendentes, alarga las
+// 0/ cortas con inserción binaria y las mezcla con una pila de corridas y galope.
+// 0/ Un arreglo ya ordenado cuesta n - 1 comparaciones
+void ordenarTimsort(int arreglo[], int n, int& comparaciones, bool verbose = false);
+
+// 0/ MergeSort estable con memoria extra O(raíz de n): las mezclas usan un buffer de raíz de n
+// 0/ cuando una mitad cabe en él y, si no, se dividen con búsqueda binaria y rotaciones.
+// 0/ O(n log n) comparaciones, O(n log² n) movimientos en el peor caso
+void mergeSortBajaMemoria(int arreglo[], int n, int& comparaciones, bool verbose = false);
+
+// 0/ MergeSort con mitades y merge como tareas en un pool con robo de trabajo.
+// 0/ hilos<=0 usa todos los núcleos; rangos de tamaño <= grano se ordenan en secuencial
+void mergeSortParalelo(int arreglo[], int izquierda, int derecha, int& comparaciones, int hilos = 0, int grano = 16384);
+
 #endif
\ No newline at end of file
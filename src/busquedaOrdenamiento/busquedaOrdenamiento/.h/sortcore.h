@@ -0,0 +1,603 @@
+#pragma once
+/**
+ * @file sortcore.h
+ * @brief Núcleo genérico de ordenamiento y búsqueda: plantillas sobre tipo, comparador y
+ *        política de instrumentación
+ * @details La política decide en tiempo de compilación si se cuentan comparaciones e
+ *          intercambios y si se imprime la traza. Con Silenciosa o Contadores las líneas de
+ *          traza desaparecen del código generado (if constexpr), así que los bucles internos
+ *          no preguntan por verbose en cada comparación. Las funciones de sort.h y search.h
+ *          sobre int son envoltorios que eligen la política una sola vez.
+ */
+
+#ifndef SORTCORE_H
+#define SORTCORE_H
+
+#include "sortnet.h"
+
+#include <functional>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+namespace nucleo
+{
+
+/**
+ * @struct Instrumentacion
+ * @brief Política de conteo y traza
+ * @tparam Cuenta Si true, lleva comparaciones e intercambios
+ * @tparam Verbose Si true, los algoritmos imprimen su traza paso a paso
+ */
+template <bool Cuenta, bool Verbose>
+struct Instrumentacion
+{
+    static constexpr bool cuenta = Cuenta;
+    static constexpr bool verbose = Verbose;
+
+    long long comparaciones = 0;
+    long long intercambios = 0;
+
+    void comparacion(long long k = 1)
+    {
+        if constexpr (Cuenta) comparaciones += k;
+    }
+
+    void intercambio(long long k = 1)
+    {
+        if constexpr (Cuenta) intercambios += k;
+    }
+};
+
+using Silenciosa = Instrumentacion<false, false>;   ///< Sin contadores ni traza: lo más rápido
+using Contadores = Instrumentacion<true, false>;    ///< Sólo contadores (lo que usan los envoltorios int)
+using Traza = Instrumentacion<true, true>;          ///< Contadores y traza paso a paso
+
+namespace detalle
+{
+
+// Particiones de este tamaño o menos se terminan con inserción en introSort
+const int UMBRAL_INSERCION = 16;
+
+// Con int y < sin traza los casos base pueden ir a las redes de sortnet.h
+template <typename T, typename Comp, typename P>
+constexpr bool usaRedes()
+{
+    return std::is_same<T, int>::value && std::is_same<Comp, std::less<int>>::value && !P::verbose;
+}
+
+template <typename T>
+void imprimir(const T* a, int n)
+{
+    for (int i = 0; i < n; i++) std::cout << a[i] << " ";
+    std::cout << "\n";
+}
+
+inline void sangria(int depth)
+{
+    for (int k = 0; k < depth; k++) std::cout << "  ";
+}
+
+template <typename T, typename P>
+void intercambiar(T* a, int x, int y, P& pol)
+{
+    T temp = a[x];
+    a[x] = a[y];
+    a[y] = temp;
+    pol.intercambio();
+}
+
+template <typename T, typename Comp, typename P>
+void quickSortInterno(T* a, int izquierda, int derecha, Comp& comp, P& pol, int depth)
+{
+    if constexpr (usaRedes<T, Comp, P>())
+    {
+        if (derecha - izquierda < RED_MAXIMO && kernelsRedActivos())
+        {
+            pol.comparacion(ordenarRedPequena(a + izquierda, derecha - izquierda + 1));
+            return;
+        }
+    }
+
+    int i = izquierda;
+    int j = derecha;
+    T pivote = a[(izquierda + derecha) / 2];
+
+    if constexpr (P::verbose)
+    {
+        sangria(depth);
+        std::cout << "[Quick] rango " << izquierda << "-" << derecha << " pivote=" << pivote << "\n";
+    }
+
+    while (i <= j)
+    {
+        while (comp(a[i], pivote)) { i++; pol.comparacion(); }
+        while (comp(pivote, a[j])) { j--; pol.comparacion(); }
+
+        if (i <= j)
+        {
+            intercambiar(a, i, j, pol);
+
+            if constexpr (P::verbose)
+            {
+                sangria(depth);
+                std::cout << "  swap i=" << i << " j=" << j << "\n";
+            }
+
+            i++;
+            j--;
+        }
+    }
+
+    if (izquierda < j) quickSortInterno(a, izquierda, j, comp, pol, depth + 1);
+    if (i < derecha)   quickSortInterno(a, i, derecha, comp, pol, depth + 1);
+}
+
+template <typename T, typename Comp, typename P>
+void merge(T* a, int izquierda, int medio, int derecha, Comp& comp, P& pol)
+{
+    int i = izquierda;
+    int j = medio + 1;
+
+    std::vector<T> temp;
+    temp.reserve(derecha - izquierda + 1);
+
+    if constexpr (P::verbose)
+        std::cout << "[Merge] combino " << izquierda << "-" << medio << " con " << (medio + 1) << "-" << derecha << "\n";
+
+    // En empate gana la izquierda: estable
+    while (i <= medio && j <= derecha)
+    {
+        pol.comparacion();
+        if (!comp(a[j], a[i])) temp.push_back(a[i++]);
+        else                   temp.push_back(a[j++]);
+    }
+
+    while (i <= medio) temp.push_back(a[i++]);
+    while (j <= derecha) temp.push_back(a[j++]);
+
+    for (int k = 0; k < (int)temp.size(); k++)
+        a[izquierda + k] = temp[k];
+}
+
+template <typename T, typename Comp, typename P>
+void mergeSortInterno(T* a, int izquierda, int derecha, Comp& comp, P& pol, int depth)
+{
+    if (izquierda >= derecha) return;
+
+    if constexpr (usaRedes<T, Comp, P>())
+    {
+        if (derecha - izquierda < RED_MAXIMO && kernelsRedActivos())
+        {
+            pol.comparacion(ordenarRedPequena(a + izquierda, derecha - izquierda + 1));
+            return;
+        }
+    }
+
+    int medio = (izquierda + derecha) / 2;
+
+    if constexpr (P::verbose)
+    {
+        sangria(depth);
+        std::cout << "[MergeSort] divido " << izquierda << "-" << derecha << " -> "
+                  << izquierda << "-" << medio << " y " << (medio + 1) << "-" << derecha << "\n";
+    }
+
+    mergeSortInterno(a, izquierda, medio, comp, pol, depth + 1);
+    mergeSortInterno(a, medio + 1, derecha, comp, pol, depth + 1);
+    merge(a, izquierda, medio, derecha, comp, pol);
+}
+
+// Inserción sobre [izquierda, derecha]; cada desplazamiento cuenta como intercambio
+template <typename T, typename Comp, typename P>
+void insercionRango(T* a, int izquierda, int derecha, Comp& comp, P& pol)
+{
+    for (int i = izquierda + 1; i <= derecha; i++)
+    {
+        T clave = a[i];
+        int j = i - 1;
+
+        while (j >= izquierda)
+        {
+            pol.comparacion();
+            if (!comp(clave, a[j])) break;
+            a[j + 1] = a[j];
+            pol.intercambio();
+            j--;
+        }
+
+        a[j + 1] = clave;
+    }
+}
+
+// Ordena a[x], a[y], a[z] entre sí: la mediana queda en a[y]
+template <typename T, typename Comp, typename P>
+void ordenarTres(T* a, int x, int y, int z, Comp& comp, P& pol)
+{
+    pol.comparacion();
+    if (comp(a[y], a[x])) intercambiar(a, x, y, pol);
+
+    pol.comparacion();
+    if (comp(a[z], a[y]))
+    {
+        intercambiar(a, y, z, pol);
+        pol.comparacion();
+        if (comp(a[y], a[x])) intercambiar(a, x, y, pol);
+    }
+}
+
+// Baja el nodo i del montículo (de máximos) que empieza en base y tiene n elementos
+template <typename T, typename Comp, typename P>
+void hundir(T* a, int base, int i, int n, Comp& comp, P& pol)
+{
+    while (true)
+    {
+        int hijo = 2 * i + 1;
+        if (hijo >= n) break;
+
+        if (hijo + 1 < n)
+        {
+            pol.comparacion();
+            if (comp(a[base + hijo], a[base + hijo + 1])) hijo++;
+        }
+
+        pol.comparacion();
+        if (!comp(a[base + i], a[base + hijo])) break;
+
+        intercambiar(a, base + i, base + hijo, pol);
+        i = hijo;
+    }
+}
+
+template <typename T, typename Comp, typename P>
+void heapSortRango(T* a, int izquierda, int derecha, Comp& comp, P& pol)
+{
+    int n = derecha - izquierda + 1;
+
+    for (int i = n / 2 - 1; i >= 0; i--)
+        hundir(a, izquierda, i, n, comp, pol);
+
+    for (int fin = n - 1; fin > 0; fin--)
+    {
+        intercambiar(a, izquierda, izquierda + fin, pol);
+        hundir(a, izquierda, 0, fin, comp, pol);
+    }
+}
+
+template <typename T, typename Comp, typename P>
+void introSortInterno(T* a, int izquierda, int derecha, Comp& comp, P& pol, int profundidadMax, int depth)
+{
+    while (derecha - izquierda + 1 > UMBRAL_INSERCION)
+    {
+        if (depth >= profundidadMax)
+        {
+            if constexpr (P::verbose)
+            {
+                sangria(depth);
+                std::cout << "[Intro] rango " << izquierda << "-" << derecha << " demasiado profundo -> heapsort\n";
+            }
+
+            heapSortRango(a, izquierda, derecha, comp, pol);
+            return;
+        }
+
+        int n = derecha - izquierda + 1;
+        int medio = izquierda + n / 2;
+
+        if (n > 128)
+        {
+            // Ninther de Tukey: mediana de las medianas de tres ternas repartidas en el rango
+            int s = n / 8;
+            ordenarTres(a, izquierda, izquierda + s, izquierda + 2 * s, comp, pol);
+            ordenarTres(a, medio - s, medio, medio + s, comp, pol);
+            ordenarTres(a, derecha - 2 * s, derecha - s, derecha, comp, pol);
+            ordenarTres(a, izquierda + s, medio, derecha - s, comp, pol);
+        }
+        else
+        {
+            ordenarTres(a, izquierda, medio, derecha, comp, pol);
+        }
+
+        T pivote = a[medio];
+
+        if constexpr (P::verbose)
+        {
+            sangria(depth);
+            std::cout << "[Intro] rango " << izquierda << "-" << derecha << " pivote=" << pivote << "\n";
+        }
+
+        int i = izquierda;
+        int j = derecha;
+
+        while (i <= j)
+        {
+            while (comp(a[i], pivote)) { i++; pol.comparacion(); }
+            while (comp(pivote, a[j])) { j--; pol.comparacion(); }
+
+            if (i <= j)
+            {
+                intercambiar(a, i, j, pol);
+                i++;
+                j--;
+            }
+        }
+
+        // Recursión sobre el lado menor y bucle sobre el mayor: la pila queda en O(log n)
+        if (j - izquierda < derecha - i)
+        {
+            if (izquierda < j) introSortInterno(a, izquierda, j, comp, pol, profundidadMax, depth + 1);
+            izquierda = i;
+        }
+        else
+        {
+            if (i < derecha) introSortInterno(a, i, derecha, comp, pol, profundidadMax, depth + 1);
+            derecha = j;
+        }
+
+        depth++;
+    }
+
+    if (izquierda < derecha)
+        insercionRango(a, izquierda, derecha, comp, pol);
+}
+
+} // namespace detalle
+
+/**
+ * @brief Burbuja: compara vecinos e intercambia si están en orden incorrecto
+ * @param a Arreglo a ordenar
+ * @param n Tamaño del arreglo
+ * @param comp Comparador "menor que" (orden débil estricto)
+ * @param pol Política de instrumentación
+ * @complexity O(n²)
+ */
+template <typename T, typename Comp, typename P>
+void ordenarBurbuja(T* a, int n, Comp comp, P& pol)
+{
+    for (int i = 0; i < n - 1; i++)
+    {
+        for (int j = 0; j < n - 1 - i; j++)
+        {
+            if constexpr (P::verbose)
+                std::cout << "[Burbuja] comparo a[" << j << "]=" << a[j]
+                          << " con a[" << (j + 1) << "]=" << a[j + 1] << "\n";
+
+            pol.comparacion();
+            if (comp(a[j + 1], a[j]))
+            {
+                detalle::intercambiar(a, j, j + 1, pol);
+
+                if constexpr (P::verbose)
+                {
+                    std::cout << "  swap -> ";
+                    detalle::imprimir(a, n);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Selección: encuentra el mínimo del resto y lo pone en su posición
+ * @param a Arreglo a ordenar
+ * @param n Tamaño del arreglo
+ * @param comp Comparador "menor que"
+ * @param pol Política de instrumentación
+ * @complexity O(n²) comparaciones, O(n) intercambios
+ */
+template <typename T, typename Comp, typename P>
+void ordenarSeleccion(T* a, int n, Comp comp, P& pol)
+{
+    for (int i = 0; i < n - 1; i++)
+    {
+        int minIdx = i;
+
+        for (int j = i + 1; j < n; j++)
+        {
+            if constexpr (P::verbose)
+                std::cout << "[Seleccion] comparo a[" << j << "]=" << a[j]
+                          << " con a[" << minIdx << "]=" << a[minIdx] << "\n";
+
+            pol.comparacion();
+            if (comp(a[j], a[minIdx])) minIdx = j;
+        }
+
+        if (minIdx != i)
+        {
+            detalle::intercambiar(a, i, minIdx, pol);
+
+            if constexpr (P::verbose)
+            {
+                std::cout << "  swap i=" << i << " con minIdx=" << minIdx << " -> ";
+                detalle::imprimir(a, n);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Inserción: toma una "clave" y la inserta en la parte ordenada
+ * @param a Arreglo a ordenar
+ * @param n Tamaño del arreglo
+ * @param comp Comparador "menor que"
+ * @param pol Política de instrumentación (cada desplazamiento cuenta como intercambio)
+ * @complexity O(n²) peor caso, O(n) si ya está ordenado
+ */
+template <typename T, typename Comp, typename P>
+void ordenarInsercion(T* a, int n, Comp comp, P& pol)
+{
+    for (int i = 1; i < n; i++)
+    {
+        T clave = a[i];
+        int j = i - 1;
+
+        if constexpr (P::verbose) std::cout << "[Insercion] clave=" << clave << "\n";
+
+        while (j >= 0)
+        {
+            pol.comparacion();
+            if (!comp(clave, a[j])) break;
+
+            if constexpr (P::verbose)
+                std::cout << "  muevo a[" << j << "]=" << a[j] << " a posicion " << (j + 1) << "\n";
+
+            a[j + 1] = a[j];
+            pol.intercambio();
+            j--;
+        }
+
+        a[j + 1] = clave;
+
+        if constexpr (P::verbose)
+        {
+            std::cout << "  inserto clave en " << (j + 1) << " -> ";
+            detalle::imprimir(a, n);
+        }
+    }
+}
+
+/**
+ * @brief QuickSort con pivote central y partición de Hoare sobre [izquierda, derecha]
+ * @param a Arreglo a ordenar
+ * @param izquierda Primer índice
+ * @param derecha Último índice (inclusive)
+ * @param comp Comparador "menor que"
+ * @param pol Política de instrumentación
+ * @complexity O(n log n) promedio, O(n²) peor caso
+ */
+template <typename T, typename Comp, typename P>
+void quickSort(T* a, int izquierda, int derecha, Comp comp, P& pol)
+{
+    if (izquierda >= derecha) return;
+    detalle::quickSortInterno(a, izquierda, derecha, comp, pol, 0);
+}
+
+/**
+ * @brief MergeSort recursivo y estable sobre [izquierda, derecha]
+ * @param a Arreglo a ordenar
+ * @param izquierda Primer índice
+ * @param derecha Último índice (inclusive)
+ * @param comp Comparador "menor que"
+ * @param pol Política de instrumentación
+ * @complexity O(n log n), memoria extra O(n) por merge
+ */
+template <typename T, typename Comp, typename P>
+void mergeSort(T* a, int izquierda, int derecha, Comp comp, P& pol)
+{
+    detalle::mergeSortInterno(a, izquierda, derecha, comp, pol, 0);
+}
+
+/**
+ * @brief IntroSort: ninther / mediana de tres, inserción en rangos chicos y heapsort de respaldo
+ * @param a Arreglo a ordenar
+ * @param izquierda Primer índice
+ * @param derecha Último índice (inclusive)
+ * @param comp Comparador "menor que"
+ * @param pol Política de instrumentación
+ * @complexity O(n log n) garantizado
+ */
+template <typename T, typename Comp, typename P>
+void introSort(T* a, int izquierda, int derecha, Comp comp, P& pol)
+{
+    int n = derecha - izquierda + 1;
+    if (n < 2) return;
+
+    // Límite de profundidad 2*floor(log2(n)), como en std::sort
+    int profundidadMax = 0;
+    for (int m = n; m > 1; m >>= 1) profundidadMax += 2;
+
+    detalle::introSortInterno(a, izquierda, derecha, comp, pol, profundidadMax, 0);
+}
+
+/**
+ * @brief Búsqueda secuencial de la primera posición equivalente a valor
+ * @param a Arreglo (no se modifica)
+ * @param n Tamaño del arreglo
+ * @param valor Valor buscado
+ * @param comp Comparador "menor que": x es equivalente a valor si ninguno es menor
+ * @param pol Política de instrumentación
+ * @return int Posición o -1
+ * @complexity O(n)
+ */
+template <typename T, typename Comp, typename P>
+int busquedaSecuencial(const T* a, int n, const T& valor, Comp comp, P& pol)
+{
+    for (int i = 0; i < n; i++)
+    {
+        if constexpr (P::verbose)
+            std::cout << "[Secuencial] i=" << i << " val=" << a[i] << "\n";
+
+        pol.comparacion();
+        if (!comp(a[i], valor) && !comp(valor, a[i])) return i;
+    }
+    return -1;
+}
+
+/**
+ * @brief Búsqueda binaria sobre un arreglo ordenado según comp
+ * @param a Arreglo ordenado (no se modifica)
+ * @param n Tamaño del arreglo
+ * @param valor Valor buscado
+ * @param comp Comparador "menor que" con el que se ordenó el arreglo
+ * @param pol Política de instrumentación
+ * @return int Alguna posición equivalente a valor, o -1
+ * @complexity O(log n)
+ */
+template <typename T, typename Comp, typename P>
+int busquedaBinaria(const T* a, int n, const T& valor, Comp comp, P& pol)
+{
+    int izquierda = 0;
+    int derecha = n - 1;
+
+    while (izquierda <= derecha)
+    {
+        int medio = izquierda + (derecha - izquierda) / 2;
+
+        if constexpr (P::verbose)
+            std::cout << "[Binaria] izq=" << izquierda << " der=" << derecha
+                      << " medio=" << medio << " valMedio=" << a[medio] << "\n";
+
+        pol.comparacion();
+        if (comp(a[medio], valor))      izquierda = medio + 1;
+        else if (comp(valor, a[medio])) derecha = medio - 1;
+        else                            return medio;
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Atajos sin instrumentación: sólo tipo y comparador
+ * @complexity La del algoritmo correspondiente
+ */
+template <typename T, typename Comp = std::less<T>>
+void quickSort(T* a, int n, Comp comp = Comp())
+{
+    Silenciosa pol;
+    quickSort(a, 0, n - 1, comp, pol);
+}
+
+template <typename T, typename Comp = std::less<T>>
+void mergeSort(T* a, int n, Comp comp = Comp())
+{
+    Silenciosa pol;
+    mergeSort(a, 0, n - 1, comp, pol);
+}
+
+template <typename T, typename Comp = std::less<T>>
+void introSort(T* a, int n, Comp comp = Comp())
+{
+    Silenciosa pol;
+    introSort(a, 0, n - 1, comp, pol);
+}
+
+template <typename T, typename Comp = std::less<T>>
+int busquedaBinaria(const T* a, int n, const T& valor, Comp comp = Comp())
+{
+    Silenciosa pol;
+    return busquedaBinaria(a, n, valor, comp, pol);
+}
+
+} // namespace nucleo
+
+#endif // SORTCORE_H
@@ -0,0 +1,124 @@
+#pragma once
+/**
+ * @file sortedlist.h
+ * @brief Contenedor ordenado mutable: insertar y borrar sin volver a ordenar todo
+ * @details Lista de hojas de capacidad fija (512 enteros = 2 KB), cada una ordenada y todas en
+ *          orden entre sí. Un arreglo con el máximo de cada hoja permite elegir la hoja con
+ *          una búsqueda binaria, y dentro de la hoja se inserta o borra desplazando a lo sumo
+ *          512 valores contiguos (memmove, sin saltos de puntero). Un árbol de Fenwick sobre
+ *          las cantidades de cada hoja da rango y selección en O(log hojas).
+ *          Una hoja llena se parte en dos y una hoja vacía se quita; esos cambios de estructura
+ *          cuestan O(hojas) pero ocurren a lo sumo una vez cada ~256 operaciones.
+ */
+
+#ifndef SORTEDLIST_H
+#define SORTEDLIST_H
+
+#include <memory>
+#include <vector>
+
+/// Capacidad de cada hoja de ListaOrdenada
+const int CAPACIDAD_HOJA = 512;
+
+/**
+ * @class ListaOrdenada
+ * @brief Multiconjunto ordenado de enteros con inserción, borrado, búsqueda, rango y selección
+ */
+class ListaOrdenada
+{
+public:
+    /**
+     * @brief Lista vacía
+     * @complexity O(1)
+     */
+    ListaOrdenada();
+
+    /**
+     * @brief Carga en bloque desde un arreglo ya ordenado (reemplaza el contenido)
+     * @param ordenado Arreglo ordenado ascendente
+     * @param n Tamaño del arreglo
+     * @complexity O(n) - las hojas quedan a 3/4 de su capacidad para absorber inserciones
+     */
+    void cargar(const int* ordenado, int n);
+
+    /**
+     * @brief Inserta valor (se admiten repetidos)
+     * @param valor Valor a insertar
+     * @complexity O(log n + CAPACIDAD_HOJA), más O(n / CAPACIDAD_HOJA) amortizado entre ~256
+     *             inserciones cuando se parte una hoja
+     */
+    void insertar(int valor);
+
+    /**
+     * @brief Borra una aparición de valor
+     * @param valor Valor a borrar
+     * @return bool false si valor no estaba
+     * @complexity Igual que insertar
+     */
+    bool borrar(int valor);
+
+    /**
+     * @brief Posición de la primera aparición de valor en el orden actual
+     * @param valor Valor buscado
+     * @return int Posición (0..tamano()-1) o -1 (igual que una binaria de primera aparición
+     *             sobre la copia ordenada)
+     * @complexity O(log n)
+     */
+    int buscar(int valor) const;
+
+    /**
+     * @brief Cantidad de valores estrictamente menores que valor
+     * @param valor Valor de referencia
+     * @return int Rango (0..tamano())
+     * @complexity O(log n)
+     */
+    int rango(int valor) const;
+
+    /**
+     * @brief k-ésimo menor valor (0 = mínimo)
+     * @param k Posición en el orden (0..tamano()-1)
+     * @return int Valor en esa posición
+     * @complexity O(log n)
+     */
+    int seleccionar(int k) const;
+
+    /**
+     * @brief Copia el contenido en orden
+     * @param salida Destino con lugar para tamano() enteros
+     * @complexity O(n)
+     */
+    void copiarA(int* salida) const;
+
+    /**
+     * @brief Cantidad de valores en la lista
+     * @return int n (cuenta repetidos)
+     * @complexity O(1)
+     */
+    int tamano() const { return n_; }
+
+    /**
+     * @brief Cantidad de hojas en uso
+     * @return int Hojas (al menos n / CAPACIDAD_HOJA; las hojas no vacías no se fusionan)
+     * @complexity O(1)
+     */
+    int hojas() const { return (int)hojas_.size(); }
+
+private:
+    struct Hoja
+    {
+        int cuenta;
+        int valores[CAPACIDAD_HOJA];
+    };
+
+    int hojaPara(int valor) const;
+    int anteriores(int h) const;
+    void sumarCuenta(int h, int delta);
+    void reconstruirFenwick();
+
+    std::vector<std::unique_ptr<Hoja>> hojas_;
+    std::vector<int> maximos_;   ///< Último valor de cada hoja
+    std::vector<int> fenwick_;   ///< Árbol de Fenwick (base 1) sobre hojas_[i]->cuenta
+    int n_;
+};
+
+#endif // SORTEDLIST_H
@@ -0,0 +1,60 @@
+#pragma once
+/**
+ * @file sortnet.h
+ * @brief Redes de ordenamiento para bloques chicos (casos base de QuickSort y MergeSort)
+ * @details Redes bitónicas de 8, 16 y 32 enteros. Con AVX2 cada bloque de 8 vive en un
+ *          registro y la red completa se hace con min/max y permutaciones, sin saltos;
+ *          sin AVX2 se usa la misma red en escalar con min/max.
+ */
+
+#ifndef SORTNET_H
+#define SORTNET_H
+
+/// Tamaño máximo que resuelven los kernels de red
+const int RED_MAXIMO = 32;
+
+/**
+ * @brief Ordena 8 enteros con una red bitónica
+ * @param a Puntero a 8 enteros
+ * @complexity O(1) - 24 comparadores
+ */
+void ordenarRed8(int* a);
+
+/**
+ * @brief Ordena 16 enteros con una red bitónica
+ * @param a Puntero a 16 enteros
+ * @complexity O(1) - 80 comparadores
+ */
+void ordenarRed16(int* a);
+
+/**
+ * @brief Ordena 32 enteros con una red bitónica
+ * @param a Puntero a 32 enteros
+ * @complexity O(1) - 240 comparadores
+ */
+void ordenarRed32(int* a);
+
+/**
+ * @brief Ordena hasta RED_MAXIMO enteros rellenando con INT_MAX hasta 8, 16 o 32
+ * @param a Arreglo a ordenar
+ * @param n Cantidad de elementos (0..RED_MAXIMO)
+ * @return int Comparadores de la red usada (para el conteo de comparaciones)
+ * @complexity O(1)
+ */
+int ordenarRedPequena(int* a, int n);
+
+/**
+ * @brief Activa o desactiva el uso de los kernels en los casos base de quickSort y mergeSort
+ * @param activo true para usarlos (por defecto activos sólo si se compiló con AVX2)
+ * @complexity O(1)
+ */
+void activarKernelsRed(bool activo);
+
+/**
+ * @brief Indica si quickSort y mergeSort usan los kernels en sus casos base
+ * @return bool Estado actual
+ * @complexity O(1)
+ */
+bool kernelsRedActivos();
+
+#endif // SORTNET_H
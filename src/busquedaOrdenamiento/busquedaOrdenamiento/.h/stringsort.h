@@ -0,0 +1,36 @@
+#pragma once
+/**
+ * @file stringsort.h
+ * @brief Ordenamiento de cadenas con quicksort multiclave y prefijos de 8 bytes en caché
+ * @details Cada cadena se representa con una entrada de 16 bytes: los 8 bytes siguientes a la
+ *          profundidad actual empaquetados en un entero de 64 bits (orden big-endian, así el
+ *          orden entero coincide con el lexicográfico) y un puntero a la cadena. La partición
+ *          de tres vías compara 8 caracteres por instrucción sin desreferenciar la cadena; sólo
+ *          el grupo "igual" avanza 8 caracteres y recarga su prefijo, de modo que los prefijos
+ *          compartidos se leen una sola vez en lugar de en cada comparación.
+ */
+
+#ifndef STRINGSORT_H
+#define STRINGSORT_H
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Ordena cadenas lexicográficamente (por bytes sin signo, como std::string::compare)
+ * @param cadenas Vector a ordenar (las cadenas se mueven, no se copian)
+ * @param verbose Si true, muestra los grupos que avanzan de profundidad
+ * @complexity O(D + n log n) comparaciones de 8 bytes, con D la suma de prefijos distinguidores
+ * @spacecomplexity O(n) para las entradas clave-puntero
+ */
+void ordenarCadenas(std::vector<std::string>& cadenas, bool verbose = false);
+
+/**
+ * @brief Permutación que ordena las cadenas, sin moverlas
+ * @param cadenas Cadenas de entrada
+ * @return std::vector<int> p tal que cadenas[p[0]] <= cadenas[p[1]] <= ...
+ * @complexity Igual que ordenarCadenas
+ */
+std::vector<int> argsortCadenas(const std::vector<std::string>& cadenas);
+
+#endif // STRINGSORT_H
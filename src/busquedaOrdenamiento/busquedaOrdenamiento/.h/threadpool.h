@@ -0,0 +1,135 @@
+#pragma once
+/**
+ * @file threadpool.h
+ * @brief Pool de hilos con robo de trabajo para los algoritmos paralelos
+ * @details Cada hilo trabajador tiene su propia cola: toma tareas del final
+ *          (LIFO, mejor localidad) y, si se queda sin trabajo, roba del
+ *          inicio de las colas de los demás. El hilo que espera un grupo de
+ *          tareas también ejecuta tareas pendientes, así que nunca se bloquea.
+ */
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class PoolHilos
+ * @brief Pool de hilos con colas por trabajador y robo de tareas
+ */
+class PoolHilos
+{
+public:
+    /**
+     * @brief Crea el pool
+     * @param hilos Hilos totales que participan (incluye al hilo que espera);
+     *              se crean hilos - 1 trabajadores
+     * @complexity O(hilos)
+     */
+    explicit PoolHilos(int hilos);
+
+    /**
+     * @brief Detiene y une a todos los trabajadores
+     * @complexity O(hilos)
+     */
+    ~PoolHilos();
+
+    PoolHilos(const PoolHilos&) = delete;
+    PoolHilos& operator=(const PoolHilos&) = delete;
+
+    /**
+     * @brief Cantidad de hilos que participan (trabajadores + hilo llamador)
+     * @return int Hilos del pool
+     * @complexity O(1)
+     */
+    int hilos() const { return hilos_; }
+
+    /**
+     * @brief Encola una tarea (en la cola propia si la llama un trabajador)
+     * @param tarea Función a ejecutar
+     * @complexity O(1) amortizado
+     */
+    void encolar(std::function<void()> tarea);
+
+    /**
+     * @brief Ejecuta una tarea pendiente en el hilo actual, si hay alguna
+     * @return bool true si ejecutó una tarea
+     * @complexity O(hilos) para buscar una cola con trabajo
+     */
+    bool ejecutarUnaPendiente();
+
+private:
+    struct Cola
+    {
+        std::mutex m;
+        std::deque<std::function<void()>> tareas;
+    };
+
+    bool tomarTarea(int indice, std::function<void()>& tarea);
+    void bucleTrabajador(int indice);
+
+    int hilos_;
+    std::vector<std::unique_ptr<Cola>> colas_;   ///< Una por trabajador + la de inyección (última)
+    std::vector<std::thread> trabajadores_;
+    std::atomic<bool> detener_;
+    std::atomic<int> pendientes_;
+    std::mutex mSueno_;
+    std::condition_variable cvSueno_;
+};
+
+/**
+ * @class GrupoTareas
+ * @brief Conjunto de tareas fork-join sobre un PoolHilos
+ * @details esperar() ayuda a ejecutar tareas mientras quedan activas,
+ *          por lo que se puede anidar desde dentro de otra tarea.
+ */
+class GrupoTareas
+{
+public:
+    explicit GrupoTareas(PoolHilos& pool) : pool_(pool), activas_(0) {}
+    ~GrupoTareas() { esperar(); }
+
+    GrupoTareas(const GrupoTareas&) = delete;
+    GrupoTareas& operator=(const GrupoTareas&) = delete;
+
+    /**
+     * @brief Lanza una tarea del grupo
+     * @param tarea Función a ejecutar
+     * @complexity O(1) amortizado
+     */
+    void lanzar(std::function<void()> tarea);
+
+    /**
+     * @brief Espera a que terminen todas las tareas lanzadas
+     * @complexity O(T) de las tareas que el hilo ejecute mientras espera
+     */
+    void esperar();
+
+private:
+    PoolHilos& pool_;
+    std::atomic<int> activas_;
+};
+
+/**
+ * @brief Número de hilos por defecto (núcleos lógicos, mínimo 1)
+ * @return int Hilos a usar cuando el llamador pasa hilos <= 0
+ * @complexity O(1)
+ */
+int hilosPorDefecto();
+
+/**
+ * @brief Pool compartido por los algoritmos paralelos
+ * @param hilos Hilos deseados (<= 0 usa hilosPorDefecto())
+ * @return PoolHilos& Pool reutilizable; se crea uno por cantidad de hilos y vive hasta el final
+ * @complexity O(1) si ya existe, O(hilos) la primera vez
+ */
+PoolHilos& poolCompartido(int hilos = 0);
+
+#endif // THREADPOOL_H